@@ -0,0 +1,123 @@
+#include <os.h>
+#include "asset.h"
+
+typedef struct
+{
+	const unsigned char *cx;
+	int cx_len, cx_size;
+	const unsigned char *bw;	/* Classic variant, NULL if shared */
+	int bw_len, bw_size;
+} ASSET_DATA;
+
+#include "asset.inc"
+
+/* Unpacked assets held for asset_get(), dropped least recently used first
+ * once they would take more than ASSET_CACHE bytes.
+ */
+static unsigned char *cache[ASSET_COUNT];
+static unsigned int last_use[ASSET_COUNT];
+static unsigned int use_clock, cached;
+
+static const unsigned char *packed(int id, int *len)
+{
+	const ASSET_DATA *a = asset_data + id;
+
+	if (! is_cx && a->bw != NULL)
+	{
+		*len = a->bw_len;
+		return a->bw;
+	}
+	*len = a->cx_len;
+	return a->cx;
+}
+
+//Unpacked size in bytes for this model
+int asset_size(int id)
+{
+	const ASSET_DATA *a = asset_data + id;
+
+	return ! is_cx && a->bw != NULL ? a->bw_size : a->cx_size;
+}
+
+//LZ4 block decoder, the input is trusted
+static void lz4_unpack(unsigned char *d, const unsigned char *s, int len)
+{
+	const unsigned char * const end = s + len;
+	const unsigned char *m;
+	unsigned int token, n;
+
+	for (;;)
+	{
+		token = *s++;
+		n = token >> 4;
+		if (n == 15)
+			do
+				n += *s;
+			while (*s++ == 255);
+		memcpy(d, s, n);
+		d += n;
+		s += n;
+		if (s >= end)
+			break;
+		m = d - (s[0] | (s[1] << 8));
+		s += 2;
+		n = token & 15;
+		if (n == 15)
+			do
+				n += *s;
+			while (*s++ == 255);
+		//Matches may overlap their own output so go a byte at a time
+		for (n += 4; n > 0; n--)
+			*d++ = *m++;
+	}
+}
+
+//Unpack straight into dst, which must hold asset_size(id) bytes
+int asset_unpack(int id, void *dst)
+{
+	const unsigned char *s;
+	int len;
+
+	if (id < 0 || id >= ASSET_COUNT || dst == NULL)
+		return 0;
+	s = packed(id, &len);
+	lz4_unpack(dst, s, len);
+	return 1;
+}
+
+void asset_free(int id)
+{
+	if (cache[id] != NULL)
+	{
+		free(cache[id]);
+		cache[id] = NULL;
+		cached -= asset_size(id);
+	}
+}
+
+//Unpacked asset, NULL if it won't fit in the cache or memory
+const void *asset_get(int id)
+{
+	const int size = asset_size(id);
+	int i, old;
+
+	if (cache[id] == NULL)
+	{
+		if (size > ASSET_CACHE)
+			return NULL;
+		while (cached + size > ASSET_CACHE)
+		{
+			for (old = -1, i = 0; i < ASSET_COUNT; i++)
+				if (cache[i] != NULL && (old < 0 || last_use[i] < last_use[old]))
+					old = i;
+			asset_free(old);
+		}
+		cache[id] = malloc(size);
+		if (cache[id] == NULL)
+			return NULL;
+		cached += size;
+		asset_unpack(id, cache[id]);
+	}
+	last_use[id] = ++use_clock;
+	return cache[id];
+}
@@ -0,0 +1,24 @@
+#ifndef __ASSET_H__
+#define __ASSET_H__
+
+/* Large images kept LZ4 packed in asset.inc and unpacked when needed.
+ * The ids follow the table in tools/mkasset.c.  The help pages have a 4 bit
+ * grey variant for the classic which is picked automatically.
+ */
+enum {
+	ASSET_BAR,		/* 320*24 title bar */
+	ASSET_NIEXIE,		/* 12*20 digits, 44 of them */
+	ASSET_ABOUT,		/* Full screen pages */
+	ASSET_HELP0,
+	ASSET_HELP1,
+	ASSET_COUNT
+};
+
+#define ASSET_CACHE	40960	/* Bytes of unpacked assets kept between uses */
+
+extern int asset_size(int id);
+extern int asset_unpack(int id, void *dst);
+extern const void *asset_get(int id);
+extern void asset_free(int id);
+
+#endif
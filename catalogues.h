@@ -22,81 +22,82 @@
 #define CATALOGUES_H_INCLUDED
 
 static const unsigned char opcode_breaks[KIND_MAX] = {
-	52, 208, 153, 47, 12, 153, 47, 
+	52, 236, 158, 50, 17, 158, 50, 
 };
 
 #define SIZE_catalogue 105
 static const unsigned char catalogue[] = {
-	0x47, 0x1b, 0x46, 0xa0, 0xc1, 0x63,
-	0x58, 0xe4, 0x18, 0xa2, 0x3c, 0x99,
-	0x16, 0xfc, 0x7d, 0x48, 0x72, 0x01,
-	0x09, 0x84, 0x4f, 0x93, 0xf6, 0x4d,
-	0x16, 0x47, 0x50, 0x56, 0xdd, 0x31,
-	0x4c, 0x92, 0x37, 0x15, 0xc6, 0x6d,
-	0x5b, 0x66, 0x8b, 0x1e, 0x73, 0x18,
-	0x56, 0xe1, 0xc4, 0x45, 0x5d, 0x06,
-	0xa9, 0x35, 0x64, 0x9a, 0x76, 0x99,
-	0xa4, 0x64, 0x1b, 0xc7, 0x2c, 0xc3,
-	0x6f, 0x5c, 0x14, 0x8b, 0x16, 0x41,
-	0xf1, 0x5c, 0x47, 0x12, 0x42, 0xd2,
-	0xa3, 0x0b, 0x1f, 0x40, 0x8a, 0x37,
-	0x09, 0x94, 0x70, 0xc3, 0x56, 0x0c,
-	0xca, 0x46, 0x11, 0x74, 0x65, 0x1b,
-	0x6f, 0x8a, 0xc7, 0x1d, 0x8f, 0x28,
-	0x09, 0xeb, 0x20, 0xaa, 0x27, 0xec,
-	0x7b, 0x16, 0xc9, 0xb2, 0xac, 0xbb,
-	0x32, 0xc6, 0x28, 0x4a, 0xb6, 0xa5,
-	0x34, 0x6b, 0x5a, 0xe6, 0xad, 0xac,
-	0x70, 0x18, 0xc4, 0x41, 0xd5, 0x6c,
-	0x9c, 0xf5, 0xf5, 0x7a, 0x6c, 0x40,
+	0x4e, 0x1d, 0x57, 0x24, 0xc1, 0x6a,
+	0x5a, 0xa4, 0x88, 0xa2, 0x3c, 0x9a,
+	0xd7, 0x80, 0x7d, 0x4f, 0x75, 0x11,
+	0x09, 0xa0, 0x56, 0x95, 0xb6, 0xbd,
+	0x32, 0x4e, 0x52, 0x17, 0x61, 0x4d,
+	0x53, 0x93, 0xf7, 0x99, 0xe7, 0x75,
+	0x9d, 0x77, 0x0f, 0x4f, 0x7c, 0x1a,
+	0x17, 0x65, 0xe5, 0x4c, 0x5f, 0x47,
+	0x2d, 0x51, 0x6b, 0x9c, 0x87, 0x1d,
+	0xc5, 0x6b, 0x1d, 0xd7, 0xb0, 0xc3,
+	0x77, 0x9e, 0x24, 0xfb, 0x47, 0x48,
+	0xf4, 0x6d, 0x0b, 0x43, 0x49, 0xd4,
+	0x63, 0x0b, 0x50, 0x40, 0x8a, 0x37,
+	0x8d, 0xb0, 0x79, 0x03, 0x56, 0x7c,
+	0xca, 0x4d, 0x13, 0x34, 0xd5, 0x37,
+	0x77, 0xca, 0xc7, 0xa1, 0xab, 0x28,
+	0x09, 0xeb, 0xe4, 0xaa, 0x27, 0xef,
+	0x8b, 0xda, 0xfa, 0xbe, 0xef, 0xcb,
+	0xf6, 0xf7, 0x28, 0x4a, 0xb7, 0x29,
+	0x50, 0x73, 0x9c, 0xf7, 0x31, 0xcd,
+	0x78, 0x5a, 0x84, 0xb1, 0xf9, 0x74,
+	0xdf, 0x36, 0x65, 0x96, 0x74, 0x80,
 };
 
 #define SIZE_program_xfcn 126
 static const unsigned char program_xfcn[] = {
-	0x47, 0x1b, 0x46, 0xa3, 0x03, 0x30,
-	0x58, 0xd6, 0x3b, 0x05, 0x41, 0x8a,
-	0x23, 0xc9, 0x91, 0x6f, 0xdc, 0xe2,
-	0x59, 0xcd, 0x1f, 0x52, 0x1c, 0x80,
-	0x42, 0x61, 0x13, 0xe4, 0xfd, 0x93,
-	0x45, 0xb0, 0x64, 0x75, 0x05, 0x6d,
-	0xd3, 0x14, 0xc9, 0x23, 0x71, 0x5c,
-	0x66, 0xd5, 0xb6, 0x68, 0xb1, 0xe7,
-	0x31, 0x85, 0x6e, 0x09, 0x47, 0x11,
-	0x15, 0x74, 0x1a, 0xa4, 0xd5, 0x92,
-	0xc2, 0x70, 0xa6, 0x9d, 0xa6, 0x60,
-	0x9a, 0x46, 0x41, 0xbc, 0x60, 0x5c,
-	0xb3, 0x0d, 0xbd, 0x70, 0x52, 0x2c,
-	0x58, 0x95, 0xbf, 0x6f, 0xf4, 0x1e,
-	0xfe, 0xc0, 0x31, 0x5c, 0x13, 0x11,
-	0xc4, 0x86, 0x84, 0x2d, 0x2a, 0xc0,
-	0x4c, 0x2c, 0x0b, 0x1f, 0x28, 0xdc,
-	0x26, 0x51, 0xc3, 0x0d, 0x58, 0x33,
-	0x29, 0x18, 0x45, 0xd1, 0x94, 0x6d,
-	0xbe, 0x2b, 0x1c, 0x76, 0x3c, 0xa0,
-	0x27, 0xac, 0x82, 0xa8, 0x9f, 0xb1,
-	0xec, 0x5b, 0x26, 0xca, 0xb2, 0xec,
-	0xcb, 0x18, 0xa1, 0x2a, 0xda, 0x94,
-	0xd1, 0xad, 0x6b, 0x9a, 0xc6, 0xad,
-	0xc0, 0x63, 0x11, 0x07, 0x59, 0xd5,
-	0x6c, 0x9c, 0xf5, 0xf5, 0x7a, 0x6c,
-	0x5d, 0x70,
+	0x4e, 0x1d, 0x57, 0x27, 0x34, 0x30,
+	0x5a, 0x96, 0xab, 0x36, 0x48, 0x8a,
+	0x23, 0xc9, 0xad, 0x78, 0x1f, 0x22,
+	0x59, 0xf1, 0x1f, 0x53, 0xdd, 0x44,
+	0x42, 0x68, 0x15, 0xa5, 0x6d, 0xaf,
+	0x4c, 0xb3, 0x74, 0xe5, 0x21, 0x76,
+	0x14, 0xd5, 0x39, 0x3f, 0x79, 0x9e,
+	0x77, 0x59, 0xd7, 0x70, 0xf4, 0xf7,
+	0xc1, 0xa1, 0x76, 0x49, 0x47, 0x95,
+	0x31, 0x7d, 0x1c, 0xb5, 0x45, 0xae,
+	0xce, 0xb3, 0xb7, 0x21, 0xc7, 0x67,
+	0x9c, 0x56, 0xb1, 0xdd, 0x67, 0x5e,
+	0xc3, 0x0d, 0xde, 0x78, 0x93, 0xed,
+	0x1c, 0x95, 0xcb, 0xb3, 0x04, 0x8f,
+	0x2f, 0xcc, 0x74, 0x6c, 0xd7, 0x42,
+	0xd0, 0xc6, 0x84, 0x9d, 0x46, 0xcc,
+	0x8c, 0x2c, 0xcf, 0x50, 0x28, 0xde,
+	0x36, 0xc1, 0xe4, 0x0d, 0x59, 0xf3,
+	0x29, 0x34, 0x4c, 0xd3, 0x54, 0xdd,
+	0xdf, 0x2b, 0x1e, 0x86, 0xac, 0xa0,
+	0x27, 0xaf, 0x92, 0xa8, 0x9f, 0xbe,
+	0x2f, 0x6b, 0xea, 0xfb, 0xbf, 0x2f,
+	0xdb, 0xdc, 0xa1, 0x2a, 0xdc, 0xa5,
+	0x41, 0xce, 0x73, 0xdc, 0xd7, 0x31,
+	0xe1, 0x6a, 0x12, 0xc7, 0xe9, 0xf9,
+	0x74, 0xdf, 0x36, 0x65, 0x96, 0x74,
+	0x9f, 0xb0,
 };
 
 #define SIZE_cplx_catalogue 24
 static const unsigned char cplx_catalogue[] = {
-	0x7c, 0x28, 0x8c, 0xaa, 0x11, 0x3d,
-	0x0f, 0x31, 0x0d, 0xea, 0x7c, 0x60,
-	0x58, 0x1a, 0x76, 0x7a, 0x67, 0xe8,
-	0x25, 0xdf, 0x7f, 0x9e, 0xb7, 0xb5,
-	0xef, 0xa6, 0xe7, 0xd8, 0x21, 0xe4,
+	0x86, 0x6b, 0x6d, 0x6e, 0x3a, 0x3d,
+	0x0f, 0x31, 0x0e, 0x13, 0x86, 0xa2,
+	0xe8, 0xbe, 0xa4, 0x84, 0xaa, 0xc8,
+	0xca, 0x08, 0x89, 0xe1, 0x48, 0x5a,
+	0x18, 0xb2, 0x6a, 0xb8, 0xc6, 0x0d,
 };
 
-#define SIZE_stats_catalogue 17
+#define SIZE_stats_catalogue 23
 static const unsigned char stats_catalogue[] = {
-	0x18, 0x05, 0xc1, 0xa0, 0x5d, 0x17,
-	0xc9, 0x71, 0x58, 0x61, 0x16, 0x85,
-	0x95, 0xe0, 0x54, 0x17, 0x85, 0x51,
-	0x4c, 0x57, 0x5e, 0x80,
+	0x18, 0x10, 0x81, 0x71, 0x05, 0x1a,
+	0x05, 0xd1, 0x7d, 0x07, 0x25, 0xc5,
+	0x61, 0x84, 0x5a, 0x43, 0x90, 0xd1,
+	0x65, 0x94, 0x15, 0x05, 0xe1, 0x54,
+	0x53, 0x41, 0x85, 0x76, 0x58,
 };
 
 #define SIZE_sums_catalogue 14
@@ -106,96 +107,100 @@ static const unsigned char sums_catalogue[] = {
 	0xf1, 0x1c, 0x49, 0x11, 0x85, 0x00,
 };
 
-#define SIZE_prob_catalogue 54
+#define SIZE_prob_catalogue 61
 static const unsigned char prob_catalogue[] = {
-	0x54, 0xd5, 0x25, 0xc1, 0x54, 0x5a,
-	0x16, 0x75, 0xdd, 0x69, 0x54, 0x14,
-	0xf5, 0xbd, 0x51, 0x52, 0x56, 0xd5,
-	0x29, 0x4b, 0x57, 0x15, 0xb5, 0xcd,
-	0x5d, 0x58, 0x96, 0x15, 0xd5, 0x63,
-	0x59, 0x56, 0x45, 0xd9, 0x66, 0x57,
-	0xd5, 0xe5, 0xd1, 0x60, 0x56, 0x55,
-	0x85, 0xc9, 0x5a, 0x55, 0x95, 0x55,
-	0xc5, 0x57, 0x51, 0x96, 0xc5, 0x1d,
-	0x48, 0x53, 0x54, 0xc5, 0xb9, 0x4e,
-	0x5a, 0x94, 0x05, 0x11, 0x45, 0x50,
-	0xd6, 0xb0,
+	0x5b, 0xd6, 0xe6, 0x31, 0x70, 0x45,
+	0x58, 0x46, 0x0d, 0x93, 0x61, 0x56,
+	0xc5, 0xad, 0x8b, 0x5b, 0x51, 0x25,
+	0x95, 0x89, 0x59, 0x96, 0x75, 0xe1,
+	0x77, 0x63, 0xd7, 0x95, 0xf9, 0x7d,
+	0x64, 0x57, 0xf6, 0x05, 0x80, 0x64,
+	0x98, 0x25, 0xed, 0x7a, 0x64, 0x17,
+	0xc4, 0x3d, 0x75, 0x5d, 0x18, 0xe5,
+	0xd9, 0x72, 0x5c, 0x58, 0xd5, 0xcd,
+	0x14, 0x58, 0x98, 0x85, 0x8d, 0x64,
+	0x44, 0x16, 0x95, 0xa1, 0x8a, 0x5a,
+	0x91, 0x36, 0x19, 0x5c, 0x58, 0x16,
+	0x15, 0x7d, 0x87, 0x44, 0x40,
 };
 
 #define SIZE_int_catalogue 60
 static const unsigned char int_catalogue[] = {
-	0x47, 0x30, 0x33, 0x07, 0x05, 0x41,
-	0x9c, 0xe2, 0x59, 0xcd, 0x10, 0xb0,
-	0x64, 0x75, 0x05, 0x6d, 0xda, 0x26,
-	0xe0, 0x94, 0xc2, 0x70, 0xa6, 0x9d,
-	0xa6, 0x60, 0x9a, 0x46, 0xf1, 0x81,
-	0x72, 0xcc, 0x36, 0xf4, 0x95, 0xbf,
-	0x6f, 0xf4, 0x1e, 0xfe, 0xc0, 0x30,
-	0x41, 0xa1, 0x0b, 0xc0, 0x70, 0x2c,
-	0x7d, 0x94, 0x0d, 0x4c, 0xa4, 0x6d,
-	0xbe, 0x2b, 0x1c, 0x7b, 0x20, 0xaa,
-	0xb1, 0xec, 0x5b, 0x26, 0xca, 0xb2,
-	0xec, 0xcb, 0x18, 0xab, 0x4d, 0x11,
-	0x07, 0x59, 0xd7,
+	0x4e, 0x33, 0x43, 0x07, 0x36, 0x48,
+	0x9f, 0x22, 0x59, 0xf1, 0x10, 0xb3,
+	0x74, 0xe5, 0x21, 0x76, 0x1c, 0x37,
+	0x64, 0x94, 0xce, 0xb3, 0xb7, 0x21,
+	0xc7, 0x67, 0x9c, 0x57, 0x75, 0x9d,
+	0x7b, 0x0c, 0x37, 0x78, 0x95, 0xcb,
+	0xb3, 0x04, 0x8f, 0x2f, 0xcc, 0x73,
+	0x51, 0xa1, 0x27, 0xcc, 0xb3, 0x3d,
+	0x41, 0xb0, 0x0d, 0x4c, 0xa4, 0xdd,
+	0xdf, 0x2b, 0x1e, 0x8b, 0xe4, 0xaa,
+	0xbe, 0x2f, 0x6b, 0xea, 0xfb, 0xbf,
+	0x2f, 0xdb, 0xdc, 0xab, 0x54, 0x12,
+	0xc7, 0xe9, 0xfb,
 };
 
 #define SIZE_test_catalogue 38
 static const unsigned char test_catalogue[] = {
-	0xc2, 0x30, 0x7c, 0x94, 0xf0, 0x2f,
-	0xcb, 0xdb, 0xd6, 0xf9, 0xbe, 0xef,
-	0xa2, 0xf2, 0xf4, 0xbd, 0xaf, 0x8b,
-	0xdf, 0x37, 0x34, 0xcb, 0xbc, 0x3a,
-	0xe3, 0x27, 0x4d, 0xa2, 0xe0, 0xbe,
+	0xce, 0x73, 0x8d, 0x58, 0xf0, 0x2f,
+	0xcb, 0xdc, 0x9b, 0x2a, 0xcb, 0x32,
+	0xb2, 0xf3, 0x25, 0xc9, 0xf2, 0x9c,
+	0xa3, 0x68, 0x34, 0xcb, 0xbc, 0xff,
+	0x14, 0x27, 0x4d, 0xa2, 0xe0, 0xbe,
 	0x2e, 0x8d, 0x42, 0xe4, 0xd0, 0x3f,
-	0xad, 0x0b, 0x44, 0xd5, 0x35, 0xac,
-	0xfb, 0x4e, 0xd2, 0x2d, 0xcf, 0xf0,
+	0xb0, 0x1c, 0x08, 0xd5, 0x35, 0xb0,
+	0x0c, 0x13, 0x03, 0x2d, 0xcf, 0xf0,
 };
 
-#define SIZE_prog_catalogue 94
+#define SIZE_prog_catalogue 109
 static const unsigned char prog_catalogue[] = {
-	0xb5, 0xcd, 0x1c, 0xe8, 0x79, 0x1d,
-	0x47, 0x81, 0xc8, 0x74, 0x2a, 0x32,
-	0x94, 0x0e, 0xe0, 0x10, 0xad, 0xcb,
-	0x78, 0x6e, 0xa8, 0xaf, 0x33, 0x82,
-	0xe9, 0xba, 0xb3, 0x5c, 0xcb, 0x33,
-	0xcd, 0xb3, 0x8c, 0xd0, 0xcc, 0xb8,
-	0x6d, 0xdb, 0x7f, 0x1a, 0x39, 0xce,
-	0x93, 0xb0, 0xe8, 0x3b, 0x71, 0xc3,
-	0x78, 0xdd, 0xc6, 0xc3, 0x43, 0x70,
-	0xea, 0x1c, 0x0e, 0xbc, 0x66, 0xc3,
-	0x39, 0x4d, 0xf1, 0xd8, 0xcd, 0x1b,
-	0x4b, 0x12, 0xbc, 0xb2, 0x2c, 0x0e,
-	0x63, 0x90, 0xe1, 0x38, 0x8e, 0x3b,
-	0x58, 0xd2, 0x0d, 0xec, 0x23, 0x02,
-	0xb4, 0x2a, 0x71, 0x30, 0xe8, 0xcb,
-	0xac, 0xab, 0x3c, 0x40, 0xae, 0x2b,
-	0x70, 0xfc, 0x98, 0xfc, 0xcb, 0x73,
-	0x1c, 0xe4, 0xf5, 0xca, 0xcf, 0x63,
-	0xdf, 0x2e, 0x3f, 0x4f, 0x93, 0xe8,
-	0xf8, 0x3e, 0xf2, 0xc0,
+	0xc2, 0x0d, 0x1d, 0xac, 0x79, 0x1d,
+	0x47, 0x81, 0xc8, 0x74, 0x2a, 0x35,
+	0xac, 0x44, 0x42, 0xc3, 0x70, 0xf1,
+	0xba, 0xd3, 0xc9, 0x0e, 0x0c, 0x6b,
+	0x1b, 0xd9, 0xb6, 0x3d, 0x93, 0x67,
+	0xda, 0x76, 0x53, 0x33, 0x12, 0xc3,
+	0xb1, 0x0d, 0x2c, 0xe7, 0x3a, 0x4e,
+	0xc3, 0xa0, 0xed, 0xd3, 0x4d, 0xe3,
+	0x77, 0x4c, 0x0d, 0x0d, 0xc3, 0xa8,
+	0x70, 0x3a, 0xf4, 0xab, 0xd0, 0xe5,
+	0x37, 0xc7, 0x63, 0x34, 0x6d, 0x47,
+	0x0b, 0x12, 0xbd, 0x19, 0x7b, 0x5b,
+	0xc6, 0xf5, 0xbb, 0x45, 0x91, 0xb8,
+	0x01, 0x0c, 0x2c, 0x90, 0xb4, 0x25,
+	0x0a, 0x2c, 0x11, 0x74, 0x69, 0x18,
+	0x39, 0x8e, 0x43, 0x84, 0xe2, 0x38,
+	0xf0, 0x73, 0x48, 0x37, 0xbc, 0xcc,
+	0x0b, 0x94, 0xa9, 0xd1, 0x03, 0xa3,
+	0x2e, 0xe3, 0xb9, 0x34, 0x12, 0xb8,
+	0xad, 0xd0, 0x35, 0x73, 0xf3, 0x5e,
+	0xd8, 0xb6, 0xa3, 0xd7, 0x5c, 0x3d,
+	0x8f, 0x7d, 0x7c, 0xfd, 0x3e, 0x4f,
+	0xa3, 0xe0, 0xfb, 0xd7, 0x40,
 };
 
 #define SIZE_mode_catalogue 54
 static const unsigned char mode_catalogue[] = {
-	0x29, 0x48, 0xc2, 0x90, 0x8b, 0xc2,
-	0xc6, 0x63, 0xbc, 0xee, 0x1f, 0x88,
-	0x01, 0xfc, 0x7c, 0xbc, 0x09, 0x81,
+	0x29, 0x48, 0xc2, 0x90, 0x8b, 0xcf,
+	0x06, 0x63, 0xbc, 0xee, 0x1f, 0x88,
+	0x01, 0xfc, 0x7c, 0xc8, 0x49, 0x81,
 	0x8c, 0xcf, 0x24, 0x49, 0xc2, 0x6c,
 	0x62, 0x19, 0x49, 0x32, 0x48, 0x9a,
-	0x19, 0x31, 0x82, 0x10, 0x83, 0xc7,
-	0x71, 0x42, 0x20, 0x87, 0x32, 0x0a,
+	0x19, 0x34, 0x92, 0x10, 0x83, 0xd3,
+	0xb4, 0x52, 0x20, 0x87, 0x32, 0x0a,
 	0x63, 0x10, 0xc7, 0x32, 0x4a, 0x73,
 	0x14, 0xc6, 0x23, 0x8c, 0xe0, 0xe0,
-	0x39, 0xc5, 0xc8, 0x62, 0x14, 0x8d,
-	0xbf, 0x10, 0x14, 0x00, 0x99, 0xcc,
-	0x32, 0xf0,
+	0x39, 0xd2, 0x08, 0x62, 0x14, 0x8d,
+	0xcb, 0x50, 0x14, 0x00, 0x99, 0xd8,
+	0x76, 0x00,
 };
 
 #define SIZE_alpha_catalogue 14
 static const unsigned char alpha_catalogue[] = {
-	0x0d, 0x4a, 0xc2, 0x80, 0x9e, 0xb2,
-	0x0a, 0xa2, 0x7e, 0xc5, 0xb2, 0x6c,
-	0xab, 0x2e, 0xcc, 0x28, 0x4a, 0xb0,
+	0x0d, 0x4a, 0xc2, 0x80, 0x9e, 0xbe,
+	0x4a, 0xa2, 0x7e, 0xf6, 0xbe, 0xaf,
+	0xbb, 0xf2, 0xfd, 0x28, 0x4a, 0xb0,
 };
 
 #define SIZE_conv_catalogue 88
@@ -217,12 +222,15 @@ static const unsigned char conv_catalogue[] = {
 	0x46, 0x42, 0x44, 0x1f,
 };
 
-#define SIZE_matrix_catalogue 19
+#define SIZE_matrix_catalogue 31
 static const unsigned char matrix_catalogue[] = {
-	0x66, 0xdd, 0x43, 0x64, 0xd8, 0x35,
-	0xdd, 0x23, 0x6d, 0x95, 0x72, 0x59,
-	0x67, 0x21, 0xd1, 0x72, 0x99, 0xa6,
-	0x71, 0xd3, 0x66, 0x59, 0x86, 0x5c,
+	0x6d, 0xd1, 0xe7, 0xe1, 0xfe, 0x7f,
+	0xdf, 0xd4, 0x74, 0xd9, 0x36, 0x0d,
+	0x77, 0xd8, 0xdb, 0x6c, 0x5e, 0xa6,
+	0xc9, 0xe9, 0x7d, 0x5b, 0xa7, 0xad,
+	0x04, 0x7f, 0x1b, 0x66, 0xe1, 0xb9,
+	0x40, 0xdf, 0x76, 0xd5, 0xb4, 0x7b,
+	0x9e, 0xf6, 0xcc,
 };
 
 #define SIZE_alpha_symbols 19
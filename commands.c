@@ -31,6 +31,7 @@
 #include "printer.h"
 #endif
 #include "matrix.h"
+#include "poly.h"
 #ifdef INCLUDE_STOPWATCH
 #include "stopwatch.h"
 #endif
@@ -310,6 +311,15 @@ const struct monfunc monfuncs[ NUM_MONADIC ] = {
 #ifdef INCLUDE_XROM_DIGAMMA
 	FUNC(OP_DIGAMMA,XMR(DIGAMMA),		XMC(CPX_DIGAMMA),	NOFN,	"\226",		"DIGAMMA")
 #endif
+#ifdef MATRIX_HEAP
+	FUNC(OP_MAT_NEW, &matrix_new,		NOFN,		NOFN,		"M.NEW",	CNULL)
+#endif
+#ifdef MATRIX_FACTOR
+	FUNC(OP_MAT_CHOL, &matrix_cholesky,	NOFN,		NOFN,		"M.CHOL",	CNULL)
+#endif
+	FUNC(OP_REG_MIN, &stats_regmin,		NOFN,		NOFN,		"R-MIN",	CNULL)
+	FUNC(OP_REG_MAX, &stats_regmax,		NOFN,		NOFN,		"R-MAX",	CNULL)
+	FUNC(OP_REG_MEDIAN, &stats_regmedian,	NOFN,		NOFN,		"R-MED",	CNULL)
 #undef FUNC
 };
 
@@ -404,6 +414,9 @@ const struct dyfunc dyfuncs[ NUM_DYADIC ] = {
 	FUNC(OP_BESYN,	XDR(BES_YN),		XDC(CPX_YN),	NOFN,		"Yn",		CNULL)
 	FUNC(OP_BESKN,	XDR(BES_KN),		XDC(CPX_KN),	NOFN,		"Kn",		CNULL)
 #endif
+	FUNC(OP_REG_KTH, &stats_regkth,		NOFN,		NOFN,		"R-KTH",	CNULL)
+	FUNC(OP_POLY,	&poly_eval,		&cpx_poly_eval,	NOFN,		"POLY",		CNULL)
+	FUNC(OP_POLY_ROOTS, &poly_roots,		NOFN,		NOFN,		"PROOTS",	CNULL)
 #undef FUNC
 };
 
@@ -446,6 +459,13 @@ const struct trifunc trifuncs[ NUM_TRIADIC ] = {
 	FUNC(OP_MULMOD, 	(FP_TRIADIC_REAL) NOFN,	&intmodop,		"\034MOD",	CNULL)
 	FUNC(OP_EXPMOD, 	(FP_TRIADIC_REAL) NOFN,	&intmodop,		"^MOD",		CNULL)
 #endif
+	FUNC(OP_MAT_GET,	&matrix_get,		(FP_TRIADIC_INT) NOFN,	"M.GET",	CNULL)
+#ifdef MATRIX_FACTOR
+	FUNC(OP_MAT_SPD_EQN,	&matrix_spd_eqn,	(FP_TRIADIC_INT) NOFN,	"LINSPD",	CNULL)
+	FUNC(OP_MAT_LSQ_EQN,	&matrix_lsq_eqn,	(FP_TRIADIC_INT) NOFN,	"LINLSQ",	CNULL)
+	FUNC(OP_MAT_REF_EQN,	&matrix_refine_eqn,	(FP_TRIADIC_INT) NOFN,	"LINREF",	CNULL)
+#endif
+	FUNC(OP_REG_QUANTILE,	&stats_regquantile,	(FP_TRIADIC_INT) NOFN,	"R-QNT",	CNULL)
 #undef FUNC
 };
 
@@ -720,6 +740,40 @@ const struct niladic niladics[ NUM_NILADIC ] = {
 #ifdef INCLUDE_STOPWATCH
 	FUNC0(OP_STOPWATCH,	&stopwatch,		"STOPW",	CNULL)
 #endif
+	FN_I0(OP_MAT_PUT,	&matrix_put,		"M.PUT",	CNULL)
+#ifdef MATRIX_HEAP
+	FN_I0(OP_MAT_FREE,	&matrix_free,		"M.FREE",	CNULL)
+#endif
+	FN_I0(OP_SIGMA_REGS,	&sigma_regs,		"R-\221+",	"R-SUM+")
+#ifdef INCLUDE_SIGMA_CSV
+	FN_I0(OP_SIGMA_CSV,	&sigma_csv,		"\221CSV",	"SUMCSV")
+#endif
+	FN_I2(OP_statSKEW,	&stats_shape,		"SKEW",		CNULL)
+	FN_I2(OP_statKURT,	&stats_shape,		"KURT",		CNULL)
+	FN_I0(OP_REGSORTD,	&op_regsort,		"R-SRTD",	CNULL)
+	FN_I0(OP_REGSORTK,	&op_regsort,		"R-SRTK",	CNULL)
+	FN_I0(OP_REGSORTKD,	&op_regsort,		"R-SRKD",	CNULL)
+	FN_I0(OP_RANDOM_FILL,	&stats_random_fill,	"R-RAN",	CNULL)
+	FUNC0(OP_XSEED,		&stats_xseed,		"XSEED",	CNULL)
+	FN_I0(OP_XJUMP,		&stats_xjump,		"XJUMP",	CNULL)
+	FN_I1(OP_RV_NORMAL,	&stats_variate,		"Norml#",	CNULL)
+	FN_I1(OP_RV_T,		&stats_variate,		"t#",		CNULL)
+	FN_I1(OP_RV_CHI2,	&stats_variate,		"\265\232#",	"CHI2#")
+	FN_I1(OP_RV_EXPON,	&stats_variate,		"Expon#",	CNULL)
+	FN_I1(OP_RV_WEIBULL,	&stats_variate,		"Weibl#",	CNULL)
+	FN_I1(OP_RV_POISSON,	&stats_variate,		"Pois\252#",	"Pois#")
+	FN_I1(OP_RV_BINOMIAL,	&stats_variate,		"Binom#",	CNULL)
+	FN_I0(OP_RV_FILL_NORMAL,	&stats_variate_fill,	"R-Nrml",	CNULL)
+	FN_I0(OP_RV_FILL_T,	&stats_variate_fill,	"R-t",		CNULL)
+	FN_I0(OP_RV_FILL_CHI2,	&stats_variate_fill,	"R-\265\232",	"R-CHI2")
+	FN_I0(OP_RV_FILL_EXPON,	&stats_variate_fill,	"R-Expo",	CNULL)
+	FN_I0(OP_RV_FILL_WEIBULL,	&stats_variate_fill,	"R-Weib",	CNULL)
+	FN_I0(OP_RV_FILL_POISSON,	&stats_variate_fill,	"R-Pois",	CNULL)
+	FN_I0(OP_RV_FILL_BINOMIAL,	&stats_variate_fill,	"R-Binm",	CNULL)
+#ifdef MATRIX_FACTOR
+	FN_I0(OP_MAT_MLR,	&matrix_mlr,		"MLR",		CNULL)
+#endif
+	FN_I0(OP_POLY_DERIV,	&poly_deriv,		"dPOLY",	CNULL)
 #ifdef _DEBUG
 	FUNC0(OP_DEBUG,		XNIL(DBG),		"DBG",		CNULL)
 #endif
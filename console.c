@@ -28,6 +28,8 @@
 #include "storage.h"
 
 #include "image.h"
+#include "asset.h"
+#include "graph.h"
 
 #include "catalogues.h"
 
@@ -493,6 +495,7 @@ void shutdown( void )
 	checksum_all();
 	setuptty( 1 );
 	save_statefile();
+	close_Screen();
 	exit( 0 );
 }
 
@@ -619,17 +622,36 @@ unsigned char WaitKeyReleased(unsigned char key)
 	//printf("key released!\r\n");
 }
 
+/* The help pages are unpacked straight into a screen buffer while shown
+ * rather than being kept around.  NULL if there's no memory for one.
+ */
+static char *open_page(int id)
+{
+	char *page = init_VRAM();
+
+	if (! asset_unpack(id, page))
+	{
+		close_VRAM(page);
+		return NULL;
+	}
+	return page;
+}
+
 void showAbout()
 {
-	char *VRAM_B;
+	char *VRAM_B, *page;
 	int conti;
 	
 	VRAM_B = init_VRAM();
+	page = open_page(ASSET_ABOUT);
+	if (VRAM_B == NULL || page == NULL)
+	{
+		close_VRAM(page);
+		close_VRAM(VRAM_B);
+		return;
+	}
 	memcpy(VRAM_B,SCREEN_BASE_ADDRESS,SCREEN_BYTES_SIZE);
-	if (is_cx)
-		slide_down(VRAM_B,gImage_about,10);
-	else
-		slide_down(VRAM_B,gImage_about_bw,10);
+	slide_down(VRAM_B,page,10);
 	conti = 1;
 	while (conti)
 	{
@@ -637,27 +659,29 @@ void showAbout()
 		if isKeyPressed(KEY_NSPIRE_DOWN)
 		{
 			conti=0;
-			if (is_cx)
-				slide_up(VRAM_B,gImage_about,10);
-			else
-				slide_up(VRAM_B,gImage_about_bw,10);
+			VRAM_A = slide_up(VRAM_B,page,10);
 			WaitKeyReleased(89);
 		}
 	}
+	close_VRAM(page);
 	close_VRAM(VRAM_B);
 }
 
 void showHelp1()
 {
-	char *VRAM_B;
+	char *VRAM_B, *page;
 	int conti;
 	
 	VRAM_B = init_VRAM();
+	page = open_page(ASSET_HELP1);
+	if (VRAM_B == NULL || page == NULL)
+	{
+		close_VRAM(page);
+		close_VRAM(VRAM_B);
+		return;
+	}
 	memcpy(VRAM_B,SCREEN_BASE_ADDRESS,SCREEN_BYTES_SIZE);
-	if (is_cx)
-		slide_down(VRAM_B,gImage_help1,10);
-	else
-		slide_down(VRAM_B,gImage_help1_bw,10);
+	slide_down(VRAM_B,page,10);
 	conti = 1;
 	while (conti)
 	{
@@ -665,10 +689,7 @@ void showHelp1()
 		if isKeyPressed(KEY_NSPIRE_DOWN)
 		{
 			conti=0;
-			if (is_cx)
-				slide_up(VRAM_B,gImage_help1,10);
-			else
-				slide_up(VRAM_B,gImage_help1_bw,10);
+			VRAM_A = slide_up(VRAM_B,page,10);
 			WaitKeyReleased(56);
 		}else
 			if isKeyPressed(KEY_NSPIRE_UP)
@@ -676,20 +697,25 @@ void showHelp1()
 				showAbout();
 			}
 	}
+	close_VRAM(page);
 	close_VRAM(VRAM_B);
 }
 
 void showHelp0()
 {
-	char *VRAM_B;
+	char *VRAM_B, *page;
 	int conti;
 	
 	VRAM_B = init_VRAM();
+	page = open_page(ASSET_HELP0);
+	if (VRAM_B == NULL || page == NULL)
+	{
+		close_VRAM(page);
+		close_VRAM(VRAM_B);
+		return;
+	}
 	memcpy(VRAM_B,SCREEN_BASE_ADDRESS,SCREEN_BYTES_SIZE);
-	if (is_cx)
-		slide_down(VRAM_B,gImage_help0,10);
-	else
-		slide_down(VRAM_B,gImage_help0_bw,10);
+	slide_down(VRAM_B,page,10);
 	conti = 1;
 	while (conti)
 	{
@@ -697,10 +723,7 @@ void showHelp0()
 		if (isKeyPressed(KEY_NSPIRE_VAR)|| isKeyPressed(KEY_NSPIRE_DOWN))
 		{
 			conti=0;
-			if (is_cx)
-				slide_up(VRAM_B,gImage_help0,10);
-			else
-				slide_up(VRAM_B,gImage_help0_bw,10);
+			VRAM_A = slide_up(VRAM_B,page,10);
 			WaitKeyReleased(56);
 		}else
 			if isKeyPressed(KEY_NSPIRE_UP)
@@ -708,6 +731,7 @@ void showHelp0()
 				showHelp1();
 			}
 	}
+	close_VRAM(page);
 	close_VRAM(VRAM_B);
 }
 
@@ -718,6 +742,7 @@ int main(int argc, char *argv[]) {
 	int c, n = 0;
 	uint16_t key;
 	int warm = 0;
+	const void *bar;
 	
 	xeq_init_contexts();
 	load_statefile();
@@ -732,9 +757,12 @@ int main(int argc, char *argv[]) {
 		lcd_ingray();
 	}
 	initTP();
-	VRAM_A = init_VRAM();
+	VRAM_A = init_Screen();
 	LCD_FillAll(VRAM_A,0x0000);
-	LCD_DispBmp(VRAM_A,0,0,320,24,(uint16_t *)gImage_bar,0xF81F);
+	bar = asset_get(ASSET_BAR);
+	if (bar != NULL)
+		LCD_DispBmp(VRAM_A,0,0,320,24,(uint16_t *)bar,0xF81F);
+	asset_free(ASSET_BAR);
 	if (setuptty(0) == 0) {
 		display();
 		JustDisplayed = 0;
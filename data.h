@@ -122,7 +122,7 @@ struct _state {
 	unsigned int entryp :      1;	// Has the user entered something since the last program stop
 	unsigned int have_stats :  1;	// Statistics registers are allocated
 	unsigned int deep_sleep :  1;   // Used to wake up correctly
-	unsigned int unused :      1;	// free
+	unsigned int sigma_moments : 1;	// Statistics registers carry the central moments
 #ifdef INFRARED
 	unsigned int print_delay : 5;   // LF delay for printer
 	signed   int local_regs : 11;   // Position on return stack where current local variables start
@@ -2106,6 +2106,7 @@ void decNumber2Fraction(decNumber *n, decNumber *d, const decNumber *x) {
 }
 
 static decNumber *gser(decNumber *res, const decNumber *a, const decNumber *x, const decNumber *gln) {
+	const decNumber *tol = is_dblmode() ? &const_1e_37 : &const_1e_32;
 	decNumber ap, del, sum, t, u;
 	int i;
 
@@ -2118,10 +2119,10 @@ static decNumber *gser(decNumber *res, const decNumber *a, const decNumber *x, c
 		dn_inc(&ap);
 		dn_divide(&t, x, &ap);
 		dn_multiply(&del, &del, &t);
-		dn_add(&t, &sum, &del);
-		if (dn_eq(&t, &sum))
+		dn_add(&sum, &sum, &del);
+		dn_multiply(&t, &sum, tol);
+		if (dn_abs_lt(&del, &t))
 			break;
-		decNumberCopy(&sum, &t);
 	}
 	dn_ln(&t, x);
 	dn_multiply(&u, &t, a);
@@ -2140,6 +2141,7 @@ static void gcheckSmall(decNumber *v)
 }
 
 static decNumber *gcf(decNumber *res, const decNumber *a, const decNumber *x, const decNumber *gln) {
+	const decNumber *tol = is_dblmode() ? &const_1e_37 : &const_1e_32;
 	decNumber an, b, c, d, h, t, u, v, i;
 	int n;
 
@@ -2162,10 +2164,10 @@ static decNumber *gcf(decNumber *res, const decNumber *a, const decNumber *x, co
 		dn_add(&c, &b, &t);
 		gcheckSmall(&c);
 		dn_multiply(&t, &d, &c);
-		dn_multiply(&u, &h, &t);
-		if (dn_eq(&h, &u))
+		dn_multiply(&h, &h, &t);
+		dn_m1(&u, &t);
+		if (dn_abs_lt(&u, tol))
 			break;
-		decNumberCopy(&h, &u);
 	}
 	dn_ln(&t, x);
 	dn_multiply(&u, &t, a);
@@ -2175,6 +2177,45 @@ static decNumber *gcf(decNumber *res, const decNumber *a, const decNumber *x, co
 	return dn_multiply(res, &t, &h);
 }
 
+/* Q(a, x) for a positive integer a is the finite Poisson sum
+ *	exp(-x) sum_{k<a} x^k / k!
+ * which needs no log gamma.  Limit x so exp(-x) stays well in range.
+ */
+static decNumber *gfinite(decNumber *res, int a, const decNumber *x) {
+	decNumber s, t, k;
+	int i;
+
+	dn_1(&s);
+	dn_1(&t);
+	decNumberZero(&k);
+	for (i=1; i<a; i++) {
+		dn_inc(&k);
+		dn_multiply(&t, &t, x);
+		dn_divide(&t, &t, &k);
+		dn_add(&s, &s, &t);
+	}
+	dn_minus(&k, x);
+	dn_exp(&t, &k);
+	return dn_multiply(res, &s, &t);
+}
+
+/* Quantile searches evaluate the regularised functions many times with
+ * the same shape, so remember the last log gamma.
+ */
+static struct {
+	decNumber a, lngamma;
+	int digits;
+} GammaCache;
+
+static decNumber *glngamma(decNumber *res, const decNumber *a) {
+	if (GammaCache.digits != Ctx.digits || ! dn_eq(&GammaCache.a, a)) {
+		decNumberLnGamma(&GammaCache.lngamma, a);
+		decNumberCopy(&GammaCache.a, a);
+		GammaCache.digits = Ctx.digits;
+	}
+	return decNumberCopy(res, &GammaCache.lngamma);
+}
+
 decNumber *decNumberGammap(decNumber *res, const decNumber *x, const decNumber *a) {
 	decNumber z, lga;
 	const int op = XeqOpCode - (OP_DYA | OP_GAMMAg);
@@ -2196,11 +2237,20 @@ decNumber *decNumberGammap(decNumber *res, const decNumber *x, const decNumber *
 
 	dn_p1(&lga, a);
 	dn_compare(&z, x, &lga);
+	if (regularised && (upper || ! decNumberIsNegative(&z)) && is_int(a)
+			&& ! dn_gt(a, &const_100) && ! dn_gt(x, &const_500)) {
+		gfinite(res, dn_to_int(a), x);
+		return upper ? res : dn_1m(res, res);
+	}
 	if (regularised)
-		decNumberLnGamma(&lga, a);
+		glngamma(&lga, a);
 	else
 		decNumberZero(&lga);
-	if (decNumberIsNegative(&z)) {
+	/* Below x = 8 the continued fraction takes several times as many
+	 * steps as the series unless a is an integer, when it terminates.
+	 * The worst case complement there still leaves 34 digits.
+	 */
+	if (decNumberIsNegative(&z) || (dn_lt(x, &const_8) && ! is_int(a))) {
 		/* Deal with a difficult case by using the other expansion */
 		if (dn_gt(a, &const_9000) && dn_gt(x, dn_multiply(&z, a, &const_0_995)))
 			goto use_cf;
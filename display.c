@@ -1270,6 +1270,31 @@ static void show_x(char *x, int exp) {
 }
 
 
+/* The last number formatted by set_x_dn().  Shift keys and menus redisplay
+ * an unchanged X, so when the number, the width and the modes all match the
+ * rounding and layout are skipped and only the digits are drawn again.
+ */
+static struct {
+	decNumber z;
+	struct _ustate ustate;
+	unsigned char flags, width, odig, negative, show_exp, len;
+	short int exp;
+	char x[50];
+} XFormat;
+
+static int xformat_flags(void) {
+	return 1 | (get_user_flag(NAN_FLAG) << 1) | (get_user_flag(regI_idx) << 2)
+		| (get_user_flag(regK_idx) << 3);
+}
+
+static int xformat_hit(const decNumber *z, int width) {
+	return XFormat.flags == xformat_flags() && XFormat.width == width
+		&& XFormat.z.digits == z->digits && XFormat.z.exponent == z->exponent
+		&& XFormat.z.bits == z->bits
+		&& xcmp(XFormat.z.lsu, z->lsu, ((z->digits + DECDPUN - 1) / DECDPUN) * sizeof(z->lsu[0])) == 0
+		&& xcmp(&XFormat.ustate, &UState, sizeof(UState)) == 0;
+}
+
 /* Display the X register in the numeric portion of the display.
  * We have to account for the various display modes and numbers of
  * digits.
@@ -1345,6 +1370,20 @@ void set_x_dn(decNumber *z, char *res, int *display_digits) {
 	if (check_special_dn(z, res))
 		return;
 
+	if (State2.smode != SDISP_SHOW && xformat_hit(z, *display_digits)) {
+		if (!res) {
+			CLR_EXP_SIGN;
+			CLR_MANT_SIGN;
+		}
+		xcopy(x, XFormat.x, XFormat.len + 1);
+		obp = x + XFormat.len;
+		odig = XFormat.odig;
+		negative = XFormat.negative;
+		show_exp = XFormat.show_exp;
+		exp = XFormat.exp;
+		goto draw;
+	}
+
 	if (State2.smode == SDISP_SHOW) {
 		dn_abs(z, z);
 		decNumberNormalize(z, z, &Ctx);
@@ -1602,6 +1641,18 @@ void set_x_dn(decNumber *z, char *res, int *display_digits) {
 #endif	
 	/* Finally, send the output to the display */
 	*obp = '\0';
+	XFormat.flags = 0;
+	decNumberCopy(&XFormat.z, z);
+	xcopy(&XFormat.ustate, &UState, sizeof(UState));
+	XFormat.width = *display_digits;
+	XFormat.odig = odig;
+	XFormat.negative = negative;
+	XFormat.show_exp = show_exp;
+	XFormat.exp = exp;
+	XFormat.len = obp - x;
+	xcopy(XFormat.x, x, XFormat.len + 1);
+	XFormat.flags = xformat_flags();
+draw:
 	if (odig > *display_digits)
 		odig = *display_digits;
 	j = (*display_digits - odig) * SEGS_PER_DIGIT;
@@ -2236,45 +2287,36 @@ static void set_status_graphic(const unsigned char *graphic) {
 }
 
 
-/* Take the given string and display as much of it as possible on the top
- * line of the display.  The font size is set by the smallp parameter.
+/* Glyph widths and bit offsets of both fonts, built on first use so the
+ * status line code doesn't decode them from the packed tables for every
+ * character drawn or measured.
+ */
+static unsigned char font_width[512];
+static unsigned short int font_posns[2][257];
+
+static void font_tables(void) {
+	int c;
+
+	if (font_width[0] != 0)
+		return;
+	for (c = 0; c < 512; c++)
+		font_width[c] = charlengths(c);
+	findlengths(font_posns[0], 0);
+	findlengths(font_posns[1], 1);
+}
+
+
+/* Lay out as much of the given string as fits on the top line of the
+ * display.  Column j of pixel row i ends up in bit j of mat[i].
  * We allow character to go one pixel beyond the display since the rightmost
  * column is almost always blank.
  */
-static void set_status_sized(const char *str, int smallp) {
-	unsigned short int posns[257];
-#ifdef INCLUDE_FONT_ESCAPE
-	// Mark posns as uninitialized, smallp must be 0 or 1 for this to work correctly.
-	int posns_state = 255;
-#endif
+static void status_layout(const char *str, int smallp, unsigned long long int mat[6]) {
 	unsigned int x = 0;
 	int i, j;
 	const int offset = smallp ? 256 : 0;
-#ifndef CONSOLE
-	unsigned long long int mat[6];
 
-	xset(mat, 0, sizeof(mat));
-#endif
-#ifndef REALBUILD
-	scopy(LastDisplayedText, str);
-#ifdef INCLUDE_FONT_ESCAPE
-	for (i = 0; LastDisplayedText[i] != '\0'; ) { // Remove 007 escapes
-		if (LastDisplayedText[i] == '\007' && LastDisplayedText[i + 1] != '\0') {
-			scopy(LastDisplayedText + i, LastDisplayedText + i + 2);
-		}
-		else {
-			++i;
-		}
-	}
-#endif
-	forceDispPlot=0;
-#endif
-#ifdef RP_PREFIX
-	RectPolConv = 0;
-#endif
-#ifndef INCLUDE_FONT_ESCAPE
-	findlengths(posns, smallp);
-#endif
+	xset(mat, 0, 6 * sizeof(mat[0]));
 	while (*str != '\0' && x <= BITMAP_WIDTH+1)  {
 		int c;
 		int width;
@@ -2304,53 +2346,114 @@ static void set_status_sized(const char *str, int smallp) {
 			c = (unsigned char) str[2] + (current_smallp ? 256 : 0);
 			str += 3;
 
-			real_width = charlengths(c);
+			real_width = font_width[c];
 		} else {
 			c = (unsigned char) *str++ + offset;
-			real_width = width = charlengths(c);
+			real_width = width = font_width[c];
 			current_smallp = smallp;
 		}
 
 		if (x + real_width > BITMAP_WIDTH+1)
 			break;
 
-		if (posns_state != current_smallp) {
-			findlengths(posns, current_smallp);
-			posns_state = current_smallp;
-		}
-		unpackchar(c, cmap, current_smallp, posns);
+		unpackchar(c, cmap, current_smallp, font_posns[current_smallp]);
 #else
 		c = (unsigned char) *str++ + offset; //doesn't matter if c is 256 too big;
 
-		//cmap = &charset[c][0];
-		width = charlengths(c);
+		width = font_width[c];
 
 		if (x + width > BITMAP_WIDTH+1)
 			break;
 
 		/* Decode the packed character bytes */
-		unpackchar(c, cmap, smallp, posns);
+		unpackchar(c, cmap, smallp, font_posns[smallp]);
 #endif
 
 		for (i=0; i<6; i++)
 			for (j=0; j<width; j++) {
 				if (x+j >= BITMAP_WIDTH)
 					break;
-#ifndef CONSOLE
 				if (cmap[i] & (1 << j))
 					mat[i] |= 1LL << (x+j);
-#else
-				dot((x+j)*6+i+MATRIX_BASE, (cmap[i] & (1 << j))?1:0);
-#endif
 			}
 		x += width;
 	}
+}
+
+
+/* Layouts of the last few status lines.  Browsing a catalogue or stepping
+ * through a program keeps showing the same handful of strings, longer ones
+ * are laid out afresh each time.
+ */
+#define STATUS_MEMO	8
+#define STATUS_KEY	48
+
+static struct {
+	char str[STATUS_KEY];
+	char smallp;
+	unsigned long long int mat[6];
+} StatusMemo[STATUS_MEMO];
+static int StatusNext;
+
+static void status_memo(const char *str, int smallp, unsigned long long int mat[6]) {
+	int i;
+
+	if (slen(str) >= STATUS_KEY) {
+		status_layout(str, smallp, mat);
+		return;
+	}
+	for (i = 0; i < STATUS_MEMO; i++)
+		if (StatusMemo[i].smallp == smallp + 1 && strcmp(StatusMemo[i].str, str) == 0) {
+			xcopy(mat, StatusMemo[i].mat, sizeof(StatusMemo[i].mat));
+			return;
+		}
+	status_layout(str, smallp, mat);
+	i = StatusNext;
+	StatusNext = (i + 1) % STATUS_MEMO;
+	scopy(StatusMemo[i].str, str);
+	StatusMemo[i].smallp = smallp + 1;
+	xcopy(StatusMemo[i].mat, mat, sizeof(StatusMemo[i].mat));
+}
+
+
+/* Take the given string and display as much of it as possible on the top
+ * line of the display.  The font size is set by the smallp parameter.
+ */
+static void set_status_sized(const char *str, int smallp) {
+	unsigned long long int mat[6];
+#ifdef CONSOLE
+	int i, j;
+#elif ! defined(REALBUILD) && defined(INCLUDE_FONT_ESCAPE)
+	int i;
+#endif
 
+#ifndef REALBUILD
+	scopy(LastDisplayedText, str);
+#ifdef INCLUDE_FONT_ESCAPE
+	for (i = 0; LastDisplayedText[i] != '\0'; ) { // Remove 007 escapes
+		if (LastDisplayedText[i] == '\007' && LastDisplayedText[i + 1] != '\0') {
+			scopy(LastDisplayedText + i, LastDisplayedText + i + 2);
+		}
+		else {
+			++i;
+		}
+	}
+#endif
+	forceDispPlot=0;
+#endif
+#ifdef RP_PREFIX
+	RectPolConv = 0;
+#endif
+	font_tables();
+	status_memo(str, smallp != 0, mat);
 
 #ifndef CONSOLE
 	set_status_grob(mat);
 #else
-	for (i=MATRIX_BASE + 6*x; i<400; i++)
+	for (j=0; j<BITMAP_WIDTH; j++)
+		for (i=0; i<6; i++)
+			dot(j*6+i+MATRIX_BASE, (mat[i] >> j) & 1);
+	for (i=MATRIX_BASE + 6*BITMAP_WIDTH; i<400; i++)
 		clr_dot(i);
 #endif
 }
@@ -2362,6 +2465,8 @@ int pixel_length(const char *s, int smallp)
 {
 	int len = 0;
 	const int offset = smallp ? 256 : 0;
+
+	font_tables();
 	while (*s != '\0') {
 #ifdef INCLUDE_FONT_ESCAPE
 		if (s[0] == '\007') {
@@ -2370,7 +2475,7 @@ int pixel_length(const char *s, int smallp)
 			continue;
 		}
 #endif
-		len += charlengths( (unsigned char) *s++ + offset );
+		len += font_width[(unsigned char) *s++ + offset];
 	}
 	return len;
 }
@@ -2454,11 +2559,12 @@ static void set_status_right(const char *str) {
 	const int toolarge = State2.disp_small || string_too_large(str);
 	const int offset = toolarge ? 256 : 0;
 
+	font_tables();
 	for (p=str; *p != '\0'; p++);
 	while (--p >= str) {
 		const unsigned int c = (unsigned char) *p + offset;
 
-		x += charlengths(c);
+		x += font_width[c];
 		if (x > BITMAP_WIDTH+1)
 			break;
 	}
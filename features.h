@@ -122,6 +122,30 @@
 // M.LU
 #define MATRIX_LU_DECOMP
 
+// Allow matrices to live on the heap instead of in the registers.
+// This lifts the 100 element limit and is saved with the state file.
+// M.NEW, M.FREE
+#define MATRIX_HEAP
+
+// Split the matrix multiply, LU elimination and inverse over this many
+// POSIX threads.  Only worthwhile for a multi-core host build.
+// #define MATRIX_THREADS 4
+
+// Include the Cholesky and QR factorisations and the refined linear solver.
+// M.CHOL, LINSPD, LINLSQ, LINREF
+#define MATRIX_FACTOR
+
+// Read x,y pairs for the statistics from the CSV file named in Alpha.
+// Only for builds with a file system.
+// SigmaCSV
+#if !defined(REALBUILD) && !defined(QTGUI) && !defined(IOS)
+#define INCLUDE_SIGMA_CSV
+#endif
+
+// Put off the logarithmic summations until a non-linear fit needs them.
+// Linear mode Sigma+ then skips two logarithms per data point.
+#define LAZY_SIGMA
+
 // Include fast path code to calculate factorials and gamma functions
 // for positive integers using a string of multiplications.
 #define GAMMA_FAST_INTEGERS
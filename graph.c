@@ -3,6 +3,8 @@
 #include "math.h"
 #include "graph.h"
 #include "image.h"
+#include "sprite.h"
+#include "asset.h"
 
 #define MIN(a,b) (((a)<(b))?(a):(b))
 #define MAX(a,b) (((a)>(b))?(a):(b))
@@ -11,6 +13,14 @@
 #define GetG(c) (((c) & 0x07E0) >> 5 )
 #define GetB(c) (((c) & 0x001F) )
 
+//The headless build counts pixel writes and screen copies through these
+#ifndef COUNT_TOUCHED
+#define COUNT_TOUCHED(n)
+#endif
+#ifndef COUNT_SCREEN
+#define COUNT_SCREEN(n)
+#endif
+
 const char RedLUT[16] =
 {
 	0,0,0,0,0,0,0,0,1,3,5,7,9,11,13,15
@@ -29,8 +39,296 @@ void Delay(unsigned int x)
 	}
 }
 
+unsigned int ColorConverter_CX2CLASSIC(unsigned int color)
+{
+	unsigned int c;
+	c=(RedLUT[GetR(color)>>1])|(GetB(color)>>1);
+	c=15-c;
+	return c;
+}
+
+/* Raster backends for the 16 bpp RGB565 (CX) and 4 bpp grey (classic)
+ * framebuffers, picked once by init_VRAM().  Colours are converted to the
+ * native format once per call, the routines below do no clipping and
+ * whole spans go out as word stores or memset.
+ */
+typedef struct
+{
+	unsigned int (*native)(unsigned int color);
+	void (*plot)(char * VRAM, int x, int y, unsigned int c);
+	void (*span)(char * VRAM, int x, int y, int w, unsigned int c);
+	void (*fill)(char * VRAM, int x, int y, int w, int h, unsigned int c);
+	void (*sprite)(char * VRAM, int x, int y, int w, int h, const uint16_t *pic, int stride, int key);
+	void (*mask)(char * VRAM, int x, int y, int w, int h, const unsigned char *bits, unsigned int c);
+	void (*runs)(char * VRAM, int x, int y, const SPRITE *s);
+} RASTER;
+
+static unsigned int CX_Native(unsigned int color)
+{	return color & 0xffff;}
+
+static void CX_Plot(char * VRAM, int x, int y, unsigned int c)
+{
+	((uint16_t *)VRAM)[x + y * 320] = c;
+	COUNT_TOUCHED(1);
+}
+
+static void CX_Span(char * VRAM, int x, int y, int w, unsigned int c)
+{
+	uint16_t * p = (uint16_t *)VRAM + x + y * 320;
+	uint32_t * q;
+	const uint32_t cc = c | (c << 16);
+
+	COUNT_TOUCHED(w);
+	if (w > 0 && ((uintptr_t)p & 2))
+	{
+		*p++ = c;
+		w--;
+	}
+	for (q = (uint32_t *)p; w >= 2; w -= 2)
+		*q++ = cc;
+	if (w)
+		*(uint16_t *)q = c;
+}
+
+static void CX_Fill(char * VRAM, int x, int y, int w, int h, unsigned int c)
+{
+	char * row = VRAM + (x + y * 320) * 2;
+	int i;
+
+	if (w == 320 && (c >> 8) == (c & 0xff))
+	{
+		memset(row, c & 0xff, h * 640);
+		COUNT_TOUCHED(h * 320);
+		return;
+	}
+	if (w == 1)
+	{
+		for (i = 0; i < h; i++)
+			((uint16_t *)row)[i * 320] = c;
+		COUNT_TOUCHED(h);
+		return;
+	}
+	CX_Span(VRAM, x, y, w, c);
+	for (i = 1; i < h; i++)
+		if (w < 16)
+			CX_Span(VRAM, x, y + i, w, c);
+		else
+		{
+			memcpy(row + i * 640, row, w * 2);
+			COUNT_TOUCHED(w);
+		}
+}
+
+static void CX_Sprite(char * VRAM, int x, int y, int w, int h, const uint16_t *pic, int stride, int key)
+{
+	uint16_t * p = (uint16_t *)VRAM + x + y * 320;
+	int i, j;
+
+	for (i = 0; i < h; i++, p += 320, pic += stride)
+	{
+		if (key < 0)
+		{
+			memcpy(p, pic, w * 2);
+			COUNT_TOUCHED(w);
+		}
+		else
+			for (j = 0; j < w; j++)
+				if (pic[j] != key)
+				{
+					p[j] = pic[j];
+					COUNT_TOUCHED(1);
+				}
+	}
+}
+
+//One byte per row, most significant bit leftmost, w <= 8 wide
+static void CX_Mask(char * VRAM, int x, int y, int w, int h, const unsigned char *bits, unsigned int c)
+{
+	uint16_t * p = (uint16_t *)VRAM + x + y * 320;
+	unsigned int b;
+	int j;
+
+	for (; h > 0; h--, p += 320)
+		for (b = *bits++ & (0xff00 >> w), j = 0; b & 0xff; b <<= 1, j++)
+			if (b & 0x80)
+			{
+				p[j] = c;
+				COUNT_TOUCHED(1);
+			}
+}
+
+static void CX_Runs(char * VRAM, int x, int y, const SPRITE *s)
+{
+	uint16_t * p = (uint16_t *)VRAM + x + y * 320;
+	const unsigned char * r = s->runs;
+	const uint16_t * pic = s->cx;
+	uint16_t * q;
+	int i, n, w;
+
+	//Runs are a few pixels long, too short to be worth a memcpy call
+	for (i = s->h; i > 0; i--, p += 320)
+		for (n = *r++, q = p; n > 0; n--, r += 2)
+		{
+			COUNT_TOUCHED(r[1]);
+			for (q += r[0], w = r[1]; w > 0; w--)
+				*q++ = *pic++;
+		}
+}
+
+static void Classic_Plot(char * VRAM, int x, int y, unsigned int c)
+{
+	unsigned char * p = (unsigned char *)VRAM + (x >> 1) + y * 160;
+	*p = ( x & 1) ? ((*p & 0xf0 ) | c ) : (( *p & 0x0f ) | ( c << 4 ));
+	COUNT_TOUCHED(1);
+}
+
+static void Classic_Span(char * VRAM, int x, int y, int w, unsigned int c)
+{
+	unsigned char * p = (unsigned char *)VRAM + (x >> 1) + y * 160;
+
+	COUNT_TOUCHED(w);
+	if (w > 0 && (x & 1))
+	{
+		*p = (*p & 0xf0) | c;
+		p++;
+		w--;
+	}
+	if (w >> 1)
+		memset(p, c * 0x11, w >> 1);
+	if (w & 1)
+		p[w >> 1] = (p[w >> 1] & 0x0f) | (c << 4);
+}
+
+static void Classic_Fill(char * VRAM, int x, int y, int w, int h, unsigned int c)
+{
+	if (w == 320)
+	{
+		memset(VRAM + y * 160, c * 0x11, h * 160);
+		COUNT_TOUCHED(h * 320);
+	}
+	else
+		for (; h > 0; h--, y++)
+			Classic_Span(VRAM, x, y, w, c);
+}
+
+static void Classic_Sprite(char * VRAM, int x, int y, int w, int h, const uint16_t *pic, int stride, int key)
+{
+	unsigned int last = 0, c = ColorConverter_CX2CLASSIC(0);
+	int i, j;
+
+	for (i = 0; i < h; i++, pic += stride)
+		for (j = 0; j < w; j++)
+			if (pic[j] != key)
+			{
+				if (pic[j] != last)
+				{
+					last = pic[j];
+					c = ColorConverter_CX2CLASSIC(last);
+				}
+				Classic_Plot(VRAM, x + j, y + i, c);
+			}
+}
+
+static void Classic_Mask(char * VRAM, int x, int y, int w, int h, const unsigned char *bits, unsigned int c)
+{
+	unsigned int b;
+	int j;
+
+	for (; h > 0; h--, y++)
+		for (b = *bits++ & (0xff00 >> w), j = 0; b & 0xff; b <<= 1, j++)
+			if (b & 0x80)
+				Classic_Plot(VRAM, x + j, y, c);
+}
+
+//Grey pixels go out two to a byte between the odd nibbles at either end
+static void Classic_Runs(char * VRAM, int x, int y, const SPRITE *s)
+{
+	unsigned char * row = (unsigned char *)VRAM + y * 160;
+	const unsigned char * r = s->runs;
+	const unsigned char * g = s->grey;
+	unsigned char * p;
+	int i, n, j, w;
+
+	for (i = s->h; i > 0; i--, row += 160)
+		for (n = *r++, j = x; n > 0; n--, r += 2)
+		{
+			j += r[0];
+			w = r[1];
+			COUNT_TOUCHED(w);
+			p = row + (j >> 1);
+			j += w;
+			if ((j - w) & 1)
+			{
+				*p = (*p & 0xf0) | *g++;
+				p++;
+				w--;
+			}
+			for (; w > 1; w -= 2, g += 2)
+				*p++ = (g[0] << 4) | g[1];
+			if (w)
+				*p = (*p & 0x0f) | (*g++ << 4);
+		}
+}
+
+static const RASTER Raster_CX =
+{
+	&CX_Native, &CX_Plot, &CX_Span, &CX_Fill, &CX_Sprite, &CX_Mask, &CX_Runs
+};
+
+static const RASTER Raster_Classic =
+{
+	&ColorConverter_CX2CLASSIC, &Classic_Plot, &Classic_Span, &Classic_Fill, &Classic_Sprite, &Classic_Mask, &Classic_Runs
+};
+
+static const RASTER * Raster = &Raster_CX;
+
+//Clip a w*h box at x,y to the screen, giving the columns and rows cut off
+static int Clip(int * x, int * y, int * w, int * h, int * dx, int * dy)
+{
+	*dx = *x < 0 ? -*x : 0;
+	*dy = *y < 0 ? -*y : 0;
+	*x += *dx;
+	*w -= *dx;
+	*y += *dy;
+	*h -= *dy;
+	if (*x + *w > 320)
+		*w = 320 - *x;
+	if (*y + *h > 240)
+		*h = 240 - *y;
+	return *w > 0 && *h > 0;
+}
+
+static void FillBox(char * VRAM, int x, int y, int w, int h, unsigned int color)
+{
+	int dx, dy;
+
+	if (! Clip(&x, &y, &w, &h, &dx, &dy))
+		return;
+	if (h == 1)
+		Raster->span(VRAM, x, y, w, Raster->native(color));
+	else
+		Raster->fill(VRAM, x, y, w, h, Raster->native(color));
+}
+
+static void Blit(char * VRAM, int x, int y, int w, int h, const uint16_t * pic, int key)
+{
+	const int stride = w;
+	int dx, dy;
+
+	if (Clip(&x, &y, &w, &h, &dx, &dy))
+		Raster->sprite(VRAM, x, y, w, h, pic + dx + dy * stride, stride, key);
+}
+
+//Plot a colour already in the native format
+static void Plot(char * VRAM, int x, int y, unsigned int c)
+{
+	if ((unsigned int)x < 320 && (unsigned int)y < 240)
+		Raster->plot(VRAM, x, y, c);
+}
+
 char * init_VRAM() 
 {
+	Raster = is_cx ? &Raster_CX : &Raster_Classic;
 	return malloc( SCREEN_BYTES_SIZE );
 }
 
@@ -40,36 +338,105 @@ void AllClr_VRAM(char * VRAM)
 		memset(VRAM,0x00,SCREEN_BYTES_SIZE);
 	else
 		memset(VRAM,0xff,SCREEN_BYTES_SIZE);
+	COUNT_TOUCHED(320 * 240);
+}
+
+/* The LCD scans out of one of two pages held back to back in one block.
+ * Drawing goes into the back page and presenting it moves the controller's
+ * base address there, then copies the scanlines that changed into the new
+ * back page so it again matches what is shown.  With the pages adjacent a
+ * slide between them is just a series of base addresses part way across.
+ * If the block can't be had the OS screen is drawn to by copying as before.
+ */
+static char * Page[2];
+static int Back;
+static void * OS_Screen;
+
+//Returns the page to draw into
+char * init_Screen()
+{
+	const int size = SCREEN_BYTES_SIZE;
+	char * VRAM = init_VRAM();	//Also picks the raster backend
+
+	OS_Screen = SCREEN_BASE_ADDRESS;
+	Page[0] = malloc(2 * size);
+	if (VRAM == NULL || Page[0] == NULL || ((uintptr_t)Page[0] & 7))
+	{
+		free(Page[0]);
+		Page[0] = NULL;
+		return VRAM;
+	}
+	close_VRAM(VRAM);
+	Page[1] = Page[0] + size;
+	memcpy(Page[0], OS_Screen, size);
+	memcpy(Page[1], OS_Screen, size);
+	SCREEN_BASE_ADDRESS = Page[0];
+	Back = 1;
+	return Page[Back];
 }
 
+//Hand the OS back its screen with the last frame on it
+void close_Screen()
+{
+	if (Page[0] != NULL)
+	{
+		memcpy(OS_Screen, SCREEN_BASE_ADDRESS, SCREEN_BYTES_SIZE);
+		SCREEN_BASE_ADDRESS = OS_Screen;
+		free(Page[0]);
+		Page[0] = NULL;
+	}
+}
 
-void PutDisp_DDVRAM(char * VRAM)
-{	memcpy(SCREEN_BASE_ADDRESS,VRAM,SCREEN_BYTES_SIZE);}
+//Clear or copy out only the scanlines y1 to y2-1
+void RowsClr_VRAM(char * VRAM, int y1, int y2)
+{
+	const int stride = SCREEN_BYTES_SIZE / 240;
 
-void close_VRAM(char * VRAM){free(VRAM);}
+	memset(VRAM + y1 * stride, is_cx ? 0x00 : 0xff, (y2 - y1) * stride);
+	COUNT_TOUCHED((y2 - y1) * 320);
+}
 
-unsigned int ColorConverter_CX2CLASSIC(unsigned int color)
+/* Show the scanlines y1 to y2-1 of VRAM, everything else in it being as
+ * last shown, and return the buffer to draw the next frame into.  A buffer
+ * other than the back page is copied to the screen instead of flipped to.
+ */
+char * PutRows_DDVRAM(char * VRAM, int y1, int y2)
 {
-	unsigned int c;
-	c=(RedLUT[GetR(color)>>1])|(GetB(color)>>1);
-	c=15-c;
-	return c;
+	const int stride = SCREEN_BYTES_SIZE / 240;
+	const int offset = y1 * stride, n = (y2 - y1) * stride;
+
+	COUNT_SCREEN(n);
+	if (Page[0] == NULL)
+	{
+		memcpy((char *)SCREEN_BASE_ADDRESS + offset, VRAM + offset, n);
+		return VRAM;
+	}
+	if (VRAM == Page[Back])
+	{
+		SCREEN_BASE_ADDRESS = VRAM;
+		Back ^= 1;
+	}
+	else if (VRAM != SCREEN_BASE_ADDRESS)
+	{
+		memcpy((char *)SCREEN_BASE_ADDRESS + offset, VRAM + offset, n);
+		memcpy(Page[Back] + offset, VRAM + offset, n);
+		COUNT_SCREEN(n);
+		return VRAM;
+	}
+	memcpy(Page[Back] + offset, VRAM + offset, n);
+	return Page[Back];
 }
 
+char * PutDisp_DDVRAM(char * VRAM)
+{	return PutRows_DDVRAM(VRAM, 0, 240);}
+
+void close_VRAM(char * VRAM){free(VRAM);}
+
 int LCD_Point( char * VRAM , int x , int y , unsigned short int color )
 {
 	if( x < 0 || x >= 320 || y < 0 || y >= 240 )
 		return -1;
-	if (is_cx)
-	{
-		unsigned short int * p = VRAM;
-		p[x+y*320] = color;
-	}else
-	{
-		unsigned char * p = (unsigned char *)VRAM + (x >> 1) + ( y << 7 ) + (y << 5 );
-		color = ColorConverter_CX2CLASSIC(color);
-		*p = ( x & 1) ? ((*p & 0xf0 ) |color ) : (( *p & 0x0f ) | (color << 4 ));
-	}
+	Raster->plot(VRAM, x, y, Raster->native(color));
 	return 1;
 }
 
@@ -79,6 +446,7 @@ int LCD_Point_Classic( char * VRAM , int x , int y , char color )
 		return -1;
 	unsigned char * p = VRAM + (x >> 1) + ( y << 7 ) + (y << 5 );
 	*p = ( x & 1) ? ((*p & 0xf0 ) | color ) : (( *p & 0x0f ) | ( color << 4 ));
+	COUNT_TOUCHED(1);
 	return 1;
 }
 
@@ -98,10 +466,7 @@ unsigned short int LCD_GetPoint(char * VRAM,int x, int y)
 
 void AreaClr_VRAM(char * VRAM , int x1 , int y1 , int x2 , int y2 )
 {
-	int y ;
-	for( ; x1 <= x2 ; x1 ++ )
-		for( y = y1; y <= y2 ; y++ )
-			LCD_Point( VRAM , x1 , y , 0xFFFF  );
+	FillBox(VRAM, x1, y1, x2 - x1 + 1, y2 - y1 + 1, 0xFFFF);
 }
 
 void AreaRev_VRAM(char * VRAM , int x1 , int y1 , int x2 , int y2 )
@@ -114,34 +479,25 @@ void AreaRev_VRAM(char * VRAM , int x1 , int y1 , int x2 , int y2 )
 
 void LCD_FillAll(char * VRAM,unsigned int color)
 {
-	int x , y ;
-	for( x = 0 ; x < 320 ; x ++)
-		for(y = 0; y < 240 ; y ++)
-			LCD_Point(VRAM, x , y , color );
+	FillBox(VRAM, 0, 0, 320, 240, color);
 }
 
 void LCD_XLine(char * VRAM,unsigned int x0,unsigned int y0,unsigned int x1,unsigned int c)
 {
-		unsigned int i,xx0,xx1;
+		unsigned int xx0,xx1;
 	
 		xx0=MIN(x0,x1);
 		xx1=MAX(x0,x1);
-		for (i=xx0;i<=xx1;i++)
-		{
-				LCD_Point(VRAM,i,y0,c);
-		}
+		FillBox(VRAM,xx0,y0,xx1-xx0+1,1,c);
 }
 
 void LCD_YLine(char * VRAM,unsigned int x0,unsigned int y0,unsigned int y1,unsigned int c)
 {
-		unsigned int i,yy0,yy1;
+		unsigned int yy0,yy1;
 	
 		yy0=MIN(y0,y1);
 		yy1=MAX(y0,y1);
-		for (i=yy0;i<=yy1;i++)
-		{
-				LCD_Point(VRAM,x0,i,c);
-		}
+		FillBox(VRAM,x0,yy0,1,yy1-yy0+1,c);
 }
 
 void LCD_Line(char * VRAM,unsigned int x0,unsigned int y0,unsigned int x1,unsigned int y1,unsigned int color)
@@ -205,13 +561,14 @@ void LCD_Line(char * VRAM,unsigned int x0,unsigned int y0,unsigned int x1,unsign
 void LCD_Display_MiniChar(char * VRAM,int x, int y, char ch, unsigned int color)
 {
 	int i, j, pixelOn;
+	const unsigned int c = Raster->native(color);
 	for(i = 0; i < 6; i++)
 	{
 		for(j = 8; j > 0; j--)
 		{
 			pixelOn = charMap_ascii_mini[(unsigned char)ch][i] << j ;
 			pixelOn = pixelOn & 0x80 ;
-			if (pixelOn) 		LCD_Point(VRAM,x+i,y+8-j,color);
+			if (pixelOn) 		Plot(VRAM,x+i,y+8-j,c);
 			//else 			 	DrawPoint_VRAM(VRAM,x+i,y+8-j,bgColor);
 		}
 	}
@@ -221,53 +578,80 @@ void LCD_Display_6X12_Chr(unsigned char *VRAM,unsigned int left,unsigned int top
 {
   unsigned int x,y;
   unsigned int ptr;
+  const unsigned int c = Raster->native(color);
   
   ptr=(chr-0x20)*12;
+  if (left<=320-6 && top<=240-12)
+  {
+    Raster->mask((char *)VRAM,left,top,6,12,Font_Ascii_6X12E+ptr,c);
+    return;
+  }
   for (y=0;y<12;y++)
   {
     for (x=0;x<6;x++)
     {
       if (((Font_Ascii_6X12E[ptr]<<x)&0x80)==0x80)
-        LCD_Point(VRAM,left+x,top+y,color); 
+        Plot((char *)VRAM,left+x,top+y,c); 
     }
     ptr++;
   }
 }
 
-void LCD_Display_12X20_Chr(unsigned char *VRAM,unsigned int left,unsigned int top,unsigned char chr)
+/* The 12x20 digit font as tiles in the native format.  The CX copies rows
+ * straight out of the unpacked font, the classic converts a glyph to packed
+ * grey the first time it is drawn and copies those rows at even columns.
+ */
+#define NIXIE_W		12
+#define NIXIE_H		20
+#define NIXIE_GLYPHS	44
+
+static unsigned char Nixie_Grey[NIXIE_GLYPHS][NIXIE_H][NIXIE_W / 2];
+static unsigned char Nixie_Ready[NIXIE_GLYPHS];
+
+static int Nixie_Index(unsigned char chr)
 {
-  unsigned int x,y;
-  unsigned int ptr;
-	uint16_t c;
-  
 	if ((chr>=42)&&(chr<=59))
-	{
-		ptr=(chr-42)*480;
-		for (y=0;y<20;y++)
-		{
-			for (x=0;x<12;x++)
-			{
-				c=gImage_niexie[ptr++];
-				//c=c<<8;
-				c=c|(gImage_niexie[ptr++]<<8);
-				LCD_Point(VRAM,left+x,top+y,c); 
-			}
-		}
-	}else{
+		return chr-42;
 	if ((chr>64)&&(chr<91))
+		return chr-65+18;
+	return -1;
+}
+
+static const unsigned char * Nixie_Tile(const uint16_t * font, int g)
+{
+	const uint16_t * p = font + g * NIXIE_W * NIXIE_H;
+	unsigned char * t = &Nixie_Grey[g][0][0];
+	int i;
+
+	if (! Nixie_Ready[g])
 	{
-		ptr=(chr-65+18)*480;
-		for (y=0;y<20;y++)
-		{
-			for (x=0;x<12;x++)
-			{
-				c=gImage_niexie[ptr++];
-				c=c|(gImage_niexie[ptr++]<<8);
-				LCD_Point(VRAM,left+x,top+y,c); 
-			}
-		}
+		for (i = 0; i < NIXIE_W * NIXIE_H / 2; i++, p += 2)
+			t[i] = (ColorConverter_CX2CLASSIC(p[0]) << 4) | ColorConverter_CX2CLASSIC(p[1]);
+		Nixie_Ready[g] = 1;
 	}
+	return t;
+}
+
+void LCD_Display_12X20_Chr(unsigned char *VRAM,unsigned int left,unsigned int top,unsigned char chr)
+{
+	const uint16_t * font = asset_get(ASSET_NIEXIE);
+	const int g = Nixie_Index(chr);
+	const unsigned char * t;
+	unsigned char * p;
+	int y;
+
+	if (font == NULL || g < 0)
+		return;
+	if (is_cx || (left & 1) || left > 320 - NIXIE_W || top > 240 - NIXIE_H)
+	{
+		Blit((char *)VRAM,left,top,NIXIE_W,NIXIE_H,font+g*NIXIE_W*NIXIE_H,-1);
+		return;
 	}
+	t = Nixie_Tile(font, g);
+	p = VRAM + (left >> 1) + top * 160;
+	for (y = 0; y < NIXIE_H; y++, p += 160, t += NIXIE_W / 2)
+		memcpy(p, t, NIXIE_W / 2);
+	COUNT_TOUCHED(NIXIE_W * NIXIE_H);
 }
 
 void LCD_Display_8X16_Chr(char *VRAM,unsigned int left,unsigned int top,unsigned char chr)
@@ -312,86 +696,131 @@ void LCD_String(char* VRAM,unsigned int left,unsigned int top,unsigned char *s,u
   }
 }
 
-void LCD_Str(unsigned int left,unsigned int top,unsigned char *s)
+/* What LCD_Str() last drew at each position, one character per 12 pixel
+ * cell with blanks as spaces, so drawing the same again does nothing and a
+ * change redraws only the cells that differ.  A position not seen since
+ * LCD_StrReset() is taken to be blank.
+ */
+#define STR_SLOTS	8
+#define STR_CELLS	(320 / NIXIE_W + 1)	//Enough to reach the right edge
+
+static struct
 {
-  unsigned int x;
-  
-  x=0;
-  //printf("Display X=%d,Y=%d",left,top);
-  while(*s)
+	short x, y;
+	unsigned char cell[STR_CELLS];
+} Str_Shown[STR_SLOTS];
+static int Str_Used;
+
+void LCD_StrReset(void)
+{	Str_Used = 0;}
+
+//Draw into VRAM_A, non-zero if anything on screen changed
+int LCD_Str(unsigned int left,unsigned int top,unsigned char *s)
+{
+  unsigned char cell[STR_CELLS], *old;
+  int i, n, changed = 0;
+
+  for (n = 0; *s && n < STR_CELLS; n++)
   {
     if (*s<128)
+		cell[n] = Nixie_Index(*s) < 0 ? ' ' : *s;
+    else
     {
-		//if (is_cx)
-		//{
-			LCD_Display_12X20_Chr(VRAM_A,left+x,top,*s++);
-			x+=12;
-		//}else
-		//{
-		//	LCD_Display_8X16_Chr(VRAM_A,left+x,top,*s++);
-		//	x+=9;
-		//}
+		cell[n] = ' ';
+		s++;
     }
+    s++;
+  }
+  for (; n < STR_CELLS; n++)
+    cell[n] = ' ';
+
+  for (i = 0; i < Str_Used; i++)
+    if (Str_Shown[i].x == (short)left && Str_Shown[i].y == (short)top)
+      break;
+  if (i == Str_Used)
+  {
+    if (i == STR_SLOTS)
+      i = STR_SLOTS - 1;
     else
+      Str_Used++;
+    Str_Shown[i].x = left;
+    Str_Shown[i].y = top;
+    memset(Str_Shown[i].cell, ' ', STR_CELLS);
+  }
+  old = Str_Shown[i].cell;
+
+  for (i = 0; i < STR_CELLS; i++)
+    if (cell[i] != old[i])
     {
-		s+=2;
-		x+=12;
+      if (cell[i] == ' ')
+		FillBox(VRAM_A,left+i*NIXIE_W,top,NIXIE_W,NIXIE_H,0x0000);
+      else
+		LCD_Display_12X20_Chr(VRAM_A,left+i*NIXIE_W,top,cell[i]);
+      old[i] = cell[i];
+      changed = 1;
     }
-  }
+  return changed;
 }
 
-void slide_up(char * VRAM_A , char * VRAM_B , int speed)//˵AԭĻУB·ȻBϷ
+/* Put A and B in the pages and move the screen across from one to the
+ * other a step at a time, finishing with the back page a copy of the one
+ * shown.  Without the pages each step is composed and copied out.
+ * Returns the buffer to draw the next frame into as PutRows_DDVRAM does.
+ */
+static char * Slide(char * A , char * B , int from , int to , int speed)
 {
-	int j ;
-	char * temp = init_VRAM();
+	const int size = SCREEN_BYTES_SIZE, stride = size / 240;
+	const int step = is_cx ? 12 : 6;
+	char * const src[2] = { A, B };
+	char * temp;
+	int j, first;
 
-	if (is_cx)
+	if (Page[0] == NULL)
 	{
-	for( j = 0 ; j <= 240 ; j += 12 )
-	{
-		memcpy( temp ,VRAM_A , SCREEN_BYTES_SIZE  );
-		memcpy( temp + j*640 , VRAM_B , SCREEN_BYTES_SIZE - ( j  ) *640  );
-		PutDisp_DDVRAM(temp);
-		//sleep(speed);
+		temp = init_VRAM();
+		for (j = from; from < to ? j <= to : j >= to; j += from < to ? step : -step)
+		{
+			memcpy(temp, A + j * stride, size - j * stride);
+			memcpy(temp + size - j * stride, B, j * stride);
+			memcpy(SCREEN_BASE_ADDRESS, temp, size);
+			COUNT_SCREEN(size);
+			sleep(speed);
+		}
+		close_VRAM(temp);
+		return VRAM_A;
 	}
-	}else{
-	for( j = 0 ; j <= 240 ; j += 6 )
+	/* Fill the page the slide starts on and show it before writing the
+	 * other, which may be the one on screen now.
+	 */
+	first = from ? 1 : 0;
+	if (src[first] != Page[first])
 	{
-		memcpy( temp ,VRAM_A , SCREEN_BYTES_SIZE  );
-		memcpy( temp + j*160 , VRAM_B , SCREEN_BYTES_SIZE - ( j  ) *160  );
-		PutDisp_DDVRAM(temp);
-		sleep(speed);
-	}	
+		memcpy(Page[first], src[first], size);
+		COUNT_SCREEN(size);
 	}
-	close_VRAM( temp );
-}
-
-void slide_down(char * VRAM_A , char * VRAM_B , int speed)
-{
-	int j  ;
-	char * temp = init_VRAM();
-
-	if (is_cx)
+	SCREEN_BASE_ADDRESS = Page[0] + from * stride;
+	if (src[! first] != Page[! first])
 	{
-	for( j = 240 ; j >= 0 ; j -= 12 )
-	{
-		memcpy( temp ,VRAM_A , SCREEN_BYTES_SIZE  );
-		memcpy( temp + j*640 , VRAM_B , SCREEN_BYTES_SIZE - ( j  ) *640  );
-		PutDisp_DDVRAM(temp);
-		//sleep(speed);
+		memcpy(Page[! first], src[! first], size);
+		COUNT_SCREEN(size);
 	}
-	}else{
-	for( j = 240 ; j >= 0 ; j -= 6 )
+	for (j = from; from < to ? j <= to : j >= to; j += from < to ? step : -step)
 	{
-		memcpy( temp ,VRAM_A , SCREEN_BYTES_SIZE  );
-		memcpy( temp + j*160 , VRAM_B , SCREEN_BYTES_SIZE - ( j  ) *160  );
-		PutDisp_DDVRAM(temp);
+		SCREEN_BASE_ADDRESS = Page[0] + j * stride;
 		sleep(speed);
 	}
-	}
-	close_VRAM( temp );
+	Back = to ? 0 : 1;
+	memcpy(Page[Back], Page[! Back], size);
+	COUNT_SCREEN(size);
+	return Page[Back];
 }
 
+char * slide_up(char * VRAM_A , char * VRAM_B , int speed)//˵AԭĻУB·ȻBϷ
+{	return Slide(VRAM_A, VRAM_B, 240, 0, speed);}
+
+char * slide_down(char * VRAM_A , char * VRAM_B , int speed)
+{	return Slide(VRAM_A, VRAM_B, 0, 240, speed);}
+
 void LCD_FillRect(char * VRAM, int x1 , int y1 ,int x2 ,int y2,unsigned int color)
 {
 	int i ;
@@ -403,8 +832,7 @@ void LCD_FillRect(char * VRAM, int x1 , int y1 ,int x2 ,int y2,unsigned int colo
 	{
 		i = y1 ; y1 = y2 ; y2 = i ;
 	}
-	for(;y1 <= y2 ; y1 ++)
-		LCD_XLine(VRAM, x1 , y1 , x2 ,color );
+	FillBox(VRAM, x1, y1, x2 - x1 + 1, y2 - y1 + 1, color);
 }
 
 void LCD_EmuPx(int x1 , int y1)
@@ -415,17 +843,24 @@ void LCD_EmuPx(int x1 , int y1)
 
 void LCD_DispBmp(char *VRAM,uint16_t x,uint16_t y,uint16_t w,uint16_t h,uint16_t *pic,uint16_t key)
 {
-  uint16_t i,j,c;
+  Blit(VRAM,x,y,w,h,pic,key);
+}
 
-  for(i=0;i<h;i++)
-  {
-    for(j=0;j<w;j++)
-    {
-      c=(*pic++);
-	  if (c!=key)
-		LCD_Point(VRAM,x+j,y+i,c);
-    }
-  }
+//Sprites partly off screen are plotted a pixel at a time
+void LCD_DispSprite(char *VRAM, int x, int y, const SPRITE *s)
+{
+	const unsigned char * r = s->runs;
+	int i, j, n, w, k = 0;
+
+	if (x >= 0 && y >= 0 && x + s->w <= 320 && y + s->h <= 240)
+	{
+		Raster->runs(VRAM, x, y, s);
+		return;
+	}
+	for (i = 0; i < s->h; i++)
+		for (n = *r++, j = x; n > 0; n--, r += 2)
+			for (j += r[0], w = r[1]; w > 0; w--, j++, k++)
+				Plot(VRAM, j, y + i, is_cx ? s->cx[k] : s->grey[k]);
 }
 
 void LCD_GradientFillH(char * VRAM,unsigned int x0,unsigned int y0,unsigned int x1,unsigned int y1,unsigned int c0,unsigned int c1)//򽥱
@@ -1,8 +1,20 @@
+#include "sprite.h"
+
 #define RGB(r,g,b) (((r>>3) & 0x1f) << 11)|(((g>>2) & 0x3f) << 5)|((b>>3) & 0x1f)
 
 char * init_VRAM() ;
+char * init_Screen();
+void close_Screen();
 void AllClr_VRAM(char * VRAM);
-void PutDisp_DDVRAM(char * VRAM);
+char * PutDisp_DDVRAM(char * VRAM);
+void RowsClr_VRAM(char * VRAM, int y1, int y2);
+char * PutRows_DDVRAM(char * VRAM, int y1, int y2);
+void LCD_FillAll(char * VRAM,unsigned int color);
+void LCD_FillRect(char * VRAM, int x1 , int y1 ,int x2 ,int y2,unsigned int color);
+void LCD_DispBmp(char *VRAM,uint16_t x,uint16_t y,uint16_t w,uint16_t h,uint16_t *pic,uint16_t key);
+void LCD_DispSprite(char *VRAM, int x, int y, const SPRITE *s);
+int LCD_Str(unsigned int left,unsigned int top,unsigned char *s);
+void LCD_StrReset(void);
 void close_VRAM(char * VRAM);
 int DrawPoint_VRAM( char * VRAM , int x , int y , char color );
 int GetPoint_VRAM(char * VRAM,int x, int y) ;
@@ -19,6 +31,6 @@ void DrawAsciiStringGray_VRAM(char *VRAM,int x,int y,char *string,int cl_fg,int
 void DrawMiniString_VRAM (char * VRAM,int x , int y , char * str , int cl_fg , int cl_bg );
 void Draw_Rect_VRAM(char * VRAM, int x1 , int y1 ,int x2 ,int y2,int color);
 void Fill_Rect_VRAM(char * VRAM, int x1 , int y1 ,int x2 ,int y2,int color);
-void slide_up(char * VRAM_A , char * VRAM_B , int speed);
-void slide_down(char * VRAM_A , char * VRAM_B , int speed);
+char * slide_up(char * VRAM_A , char * VRAM_B , int speed);
+char * slide_down(char * VRAM_A , char * VRAM_B , int speed);
 void Draw_Region_VRAM(char * VRAM ,int x1 , int y1 , int x2 , int y2 , int color );
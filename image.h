@@ -27,9 +27,6 @@ extern const unsigned char gImage_lt[120];
 //5*13
 extern const unsigned char gImage_lb[130];
 
-//320*24
-extern const unsigned char gImage_bar[15360];
-
 //19*8
 extern const unsigned char gImage_360[304];
 
@@ -76,18 +73,4 @@ extern const unsigned char gImage_slb[72];
 //28*8
 extern const unsigned char gImage_input[448];
 
-extern const unsigned char gImage_niexie[21120];
-
-extern const unsigned char gImage_about[153600];
-
-extern const unsigned char gImage_help0[153600];
-
-extern const unsigned char gImage_help1[153600];
-
-extern unsigned char const Font_Ascii_8X16E[];
-
-extern const unsigned char gImage_about_bw[38400];
-
-extern const unsigned char gImage_help0_bw[38400];
-
-extern const unsigned char gImage_help1_bw[38400];
\ No newline at end of file
+extern unsigned char const Font_Ascii_8X16E[];
\ No newline at end of file
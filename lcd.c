@@ -33,10 +33,132 @@ static unsigned char dots[400];
 #endif
 
 #ifdef NSPIRE
+#include "graph.h"
+
 unsigned char showpage=0;
 
-static void dispreg(unsigned int x,unsigned int y,const char n, int index) {
+/* The segment display is composited into VRAM_A incrementally.  shown[]
+ * holds the dots of the frame last drawn and only elements that differ
+ * are blanked and redrawn, along with any lit neighbours they overlap.
+ * Only the scanlines touched since the last frame are copied out.
+ */
+#define LCD_BG		0x0000		/* Background under the segments */
+#define LCD_PIXEL	0x03FA		/* Dot matrix pixel */
+#define LCD_PANEL_TOP	24		/* Register panel below the title bar */
+#define LCD_PANEL_BOTTOM 139		/* and above the annunciators */
+
+typedef struct {
+	short x, y, w, h;
+	const SPRITE *spr;
+} LcdSeg;
+
+static const LcdSeg big_digit[SEGS_PER_DIGIT] = {
+	{  4,  0, 13,  6, &gSprite_top },
+	{  1,  3,  5, 12, &gSprite_lt },
+	{  3, 14, 12,  5, &gSprite_middle },
+	{ 14,  3,  5, 13, &gSprite_rt },
+	{  0, 17,  5, 13, &gSprite_lb },
+	{  2, 28, 12,  5, &gSprite_bottom },
+	{ 13, 17,  5, 14, &gSprite_rb },
+	{ 17, 28,  5,  4, &gSprite_dot },
+	{ 16, 32,  6,  7, &gSprite_comma },
+};
+
+static const LcdSeg exp_digit[SEGS_PER_EXP_DIGIT] = {
+	{  3,  0,  8,  4, &gSprite_stop },
+	{  0,  3,  4,  8, &gSprite_slt },
+	{  3,  9,  7,  4, &gSprite_smiddle },
+	{  9,  4,  4,  7, &gSprite_srt },
+	{  0, 11,  4,  8, &gSprite_slb },
+	{  3, 18,  7,  4, &gSprite_sbottom },
+	{  9, 12,  4,  8, &gSprite_srb },
+};
+
+/* MANT_SIGN to RPN in order, the battery isn't shown */
+static const LcdSeg annunciator[] = {
+	{   3, 206, 12,  5, &gSprite_middle },
+	{ 258, 194,  7,  4, &gSprite_smiddle },
+	{ 213, 152, 14,  8, &gSprite_lequal },
+	{ 289, 142,  6,  3, &gSprite_sequal },
+	{ 241, 139,  8,  8, &gSprite_arrow },
+	{ 257, 139, 28,  8, &gSprite_input },
+	{   0,   0,  0,  0, NULL },
+	{ 241, 153, 19,  8, &gSprite_BEG },
+	{ 267, 153, 19,  8, &gSprite_STO },
+	{ 294, 153, 19,  8, &gSprite_RCL },
+	{ 241, 167, 19,  8, &gSprite_RAD },
+	{ 267, 167, 19,  8, &gSprite_360 },
+	{ 294, 167, 19,  8, &gSprite_RPN },
+};
+
+static unsigned char shown[400];
+static int DirtyTop = 0, DirtyBottom = SCREEN_HEIGHT;	// First frame goes out whole
+
+/* Position and bitmap of element n of dots[], zero if it has none.
+ * Dot matrix pixels have no bitmap and are filled instead.
+ */
+static int lcd_seg(int n, LcdSeg *s) {
+	if (n < SEGS_EXP_BASE) {
+		*s = big_digit[n % SEGS_PER_DIGIT];
+		s->x += 19 + 20 * (n / SEGS_PER_DIGIT);
+		s->y += 192;
+	} else if (n < MANT_SIGN) {
+		n -= SEGS_EXP_BASE;
+		*s = exp_digit[n % SEGS_PER_EXP_DIGIT];
+		s->x += 272 + 16 * (n / SEGS_PER_EXP_DIGIT);
+		s->y += 185;
+	} else if (n < MATRIX_BASE) {
+		*s = annunciator[n - MANT_SIGN];
+	} else {
+		n -= MATRIX_BASE;
+		s->x = 8 + 4 * (n / 6);
+		s->y = 150 + 4 * (n % 6);
+		s->w = s->h = 3;
+		s->spr = NULL;
+	}
+	return s->w != 0;
+}
+
+static void lcd_draw(const LcdSeg *s) {
+	if (s->spr == NULL)
+		LCD_FillRect(VRAM_A, s->x, s->y, s->x + s->w - 1, s->y + s->h - 1, LCD_PIXEL);
+	else
+		LCD_DispSprite(VRAM_A, s->x, s->y, s->spr);
+}
+
+static void lcd_dirty(int top, int bottom) {
+	if (top < DirtyTop)
+		DirtyTop = top;
+	if (bottom > DirtyBottom)
+		DirtyBottom = bottom;
+}
+
+/* The register panel rows and what each was last drawn from, the register,
+ * its raw contents and the mode it was formatted in.  A row showing the
+ * same again is neither formatted nor drawn.
+ */
+#define PANEL_X		18
+#define PANEL_Y(row)	(40 + 24 * (row))
+#define PANEL_ROWS	4
+
+static struct {
+	short index;			// Register + 1, zero if not drawn
+	unsigned char mode;
+	unsigned char reg[sizeof(REGISTER)];
+} PanelRow[PANEL_ROWS];
+
+static void dispreg(int row, const char n, int index) {
         char buf[64],outbuf[64];
+        const int mode = is_intmode() | (is_dblmode() << 1);
+        const int size = is_dblmode() ? sizeof(decimal128) : sizeof(decimal64);
+
+        if (PanelRow[row].index == index + 1 && PanelRow[row].mode == mode
+            && xcmp(PanelRow[row].reg, get_reg_n(index), size) == 0)
+                return;
+        PanelRow[row].index = index + 1;
+        PanelRow[row].mode = mode;
+        xcopy(PanelRow[row].reg, get_reg_n(index), size);
+
         if (is_intmode())
                 sprintf(buf, "%llx", (unsigned long long int)get_reg_n_int(index));
         else {
@@ -47,7 +169,8 @@ static void dispreg(unsigned int x,unsigned int y,const char n, int index) {
 	}
     sprintf(outbuf,"%c: %s", n, buf);
 	//printf(outbuf);
-	LCD_Str(x,y,outbuf);
+	if (LCD_Str(PANEL_X, PANEL_Y(row), (unsigned char *)outbuf))
+		lcd_dirty(PANEL_Y(row), PANEL_Y(row) + 20);
 }
 #else
 static void dispreg(const char n, int index) {
@@ -370,117 +493,59 @@ void show_disp(void) {
                 }
 #else
 #ifdef NSPIRE
-        int i, j, p, x;
-        int dig_base = 192;
-		
-        /* Segments 0 - 107 are the main digits */
-		dig_base = 192;
-        for (i=0; i<DISPLAY_DIGITS; i++) {
-                p = i*SEGS_PER_DIGIT;
-                x = 19+20*i;
-                if (dots[p]) {//
-						LCD_DispBmp(VRAM_A,x+4,dig_base,13,6,gImage_top,0xF81F);
-                }
-                if (dots[p+1]) {//
-						LCD_DispBmp(VRAM_A,x+1,dig_base+3,5,12,gImage_lt,0xF81F);
-                }
-                if (dots[p+3]) {//
-						LCD_DispBmp(VRAM_A,x+14,dig_base+3,5,13,gImage_rt,0xF81F);
-                }
-                if (dots[p+2]) {//
-						LCD_DispBmp(VRAM_A,x+3,dig_base+14,12,5,gImage_middle,0xF81F);
-                }
-                if (dots[p+4]) {//
-						LCD_DispBmp(VRAM_A,x+0,dig_base+17,5,13,gImage_lb,0xF81F);
-                }
-                if (dots[p+6]) {//
-						LCD_DispBmp(VRAM_A,x+13,dig_base+17,5,14,gImage_rb,0xF81F);
-                }
-                if (dots[p+5]) {//
-						LCD_DispBmp(VRAM_A,x+2,dig_base+28,12,5,gImage_bottom,0xF81F);
-                }
-                if (dots[p+7]) {//
-						LCD_DispBmp(VRAM_A,x+17,dig_base+28,5,4,gImage_dot,0xF81F);
-                }
-                if (dots[p+8]) {//
-						LCD_DispBmp(VRAM_A,x+16,dig_base+32,6,7,gImage_comma,0xF81F);
-                }
-        }
-        /* Segments 108 - 128 are the exponent digits */
-		dig_base = 185;
-        for (i=0; i<3; i++) {
-                p = i*7+108;
-                x = 272 + i * 16;
-                if (dots[p]) {
-                        LCD_DispBmp(VRAM_A,x+3,dig_base,8,4,gImage_stop,0xF81F);
-                }
-                if (dots[p+1]) {
-                        LCD_DispBmp(VRAM_A,x,dig_base+3,4,8,gImage_slt,0xF81F);
-                }
-                if (dots[p+3]) {
-                        LCD_DispBmp(VRAM_A,x+9,dig_base+4,4,7,gImage_srt,0xF81F);
-                }
-                if (dots[p+2]) {
-                        LCD_DispBmp(VRAM_A,x+3,dig_base+9,7,4,gImage_smiddle,0xF81F);
-                }
-                if (dots[p+4]) {
-                        LCD_DispBmp(VRAM_A,x+0,dig_base+11,4,8,gImage_slb,0xF81F);
-                }
-                if (dots[p+6]) {
-                        LCD_DispBmp(VRAM_A,x+9,dig_base+12,4,8,gImage_srb,0xF81F);
-                }
-                if (dots[p+5]) {
-                        LCD_DispBmp(VRAM_A,x+3,dig_base+18,7,4,gImage_sbottom,0xF81F);
-                }
-        }
-        //Segments 129 & 130 are the signs
-        if (dots[MANT_SIGN]) {
-                LCD_DispBmp(VRAM_A,3,206,12,5,gImage_middle,0xF81F);
-        }
-        if (dots[EXP_SIGN]) {
-                LCD_DispBmp(VRAM_A,258,194,7,4,gImage_smiddle,0xF81F);
-        }
-        if (dots[BIG_EQ]) {
-                LCD_DispBmp(VRAM_A,213,152,14,8,gImage_lequal,0xF81F);
-        }
-        if (dots[LIT_EQ]) {
-                LCD_DispBmp(VRAM_A,289,142,6,3,gImage_sequal,0xF81F);
-        }
-        if (dots[DOWN_ARR]) {
-                LCD_DispBmp(VRAM_A,241,139,8,8,gImage_arrow,0xF81F);
-        }
-        if (dots[INPUT]) {
-                LCD_DispBmp(VRAM_A,257,139,28,8,gImage_input,0xF81F);
-        }
-        if (dots[BATTERY]) {
-        //        MOVE(70, 10);   PRINTF("####-");
-        }
-        if (dots[BEG]) {
-                LCD_DispBmp(VRAM_A,241,153,19,8,gImage_BEG,0xF81F);
-        }
-        if (dots[STO_annun]) {
-                LCD_DispBmp(VRAM_A,267,153,19,8,gImage_STO,0xF81F);
-        }
-        if (dots[RCL_annun]) {
-                LCD_DispBmp(VRAM_A,294,153,19,8,gImage_RCL,0xF81F);
-        }
-        if (dots[RAD]) {
-                LCD_DispBmp(VRAM_A,241,167,19,8,gImage_RAD,0xF81F);
-        }
-        if (dots[DEG]) {
-                LCD_DispBmp(VRAM_A,267,167,19,8,gImage_360,0xF81F);
-        }
-        if (dots[RPN]) {
-                LCD_DispBmp(VRAM_A,294,167,19,8,gImage_RPN,0xF81F);
-        }
-        //The graphical bit last
-        for (i=0; i<BITMAP_WIDTH; i++)
-                for (j=0; j<6; j++) {
-                        if (dots[i*6+j+MATRIX_BASE]) {
-								LCD_EmuPx(i,j);
+        LcdSeg changed[MATRIX_BASE], s;
+        unsigned char hit[400 - MATRIX_BASE];
+        int i, j, nc = 0, nm = 0;
+        int left = SCREEN_WIDTH, top = SCREEN_HEIGHT, right = 0, bottom = 0;
+
+        /* Blank the elements that changed since the last frame.  Matrix dots
+         * are 3 pixels on a 4 pixel pitch and never overlap one another, so
+         * they are only flagged and bounded rather than listed.
+         */
+        for (i=0; i<400; i++)
+                if (dots[i] != shown[i]) {
+                        shown[i] = dots[i];
+                        if (lcd_seg(i, &s)) {
+                                LCD_FillRect(VRAM_A, s.x, s.y, s.x + s.w - 1, s.y + s.h - 1, LCD_BG);
+                                lcd_dirty(s.y, s.y + s.h);
+                                if (i < MATRIX_BASE)
+                                        changed[nc++] = s;
+                                else {
+                                        if (nm++ == 0)
+                                                xset(hit, 0, sizeof(hit));
+                                        hit[i - MATRIX_BASE] = 1;
+                                        if (s.x < left)
+                                                left = s.x;
+                                        if (s.y < top)
+                                                top = s.y;
+                                        if (s.x + s.w > right)
+                                                right = s.x + s.w;
+                                        if (s.y + s.h > bottom)
+                                                bottom = s.y + s.h;
+                                }
                         }
                 }
-		PutDisp_DDVRAM(VRAM_A);
+        /* Redraw the lit elements overlapping any blanked box */
+        if (nc || nm)
+                for (i=0; i<400; i++)
+                        if (dots[i] && lcd_seg(i, &s)) {
+                                if (i < MATRIX_BASE
+                                    ? s.x < right && left < s.x + s.w && s.y < bottom && top < s.y + s.h
+                                    : nm && hit[i - MATRIX_BASE]) {
+                                        lcd_draw(&s);
+                                        continue;
+                                }
+                                for (j=0; j<nc; j++)
+                                        if (s.x < changed[j].x + changed[j].w && changed[j].x < s.x + s.w &&
+                                            s.y < changed[j].y + changed[j].h && changed[j].y < s.y + s.h) {
+                                                lcd_draw(&s);
+                                                break;
+                                        }
+                        }
+        if (DirtyTop < DirtyBottom)
+                VRAM_A = PutRows_DDVRAM(VRAM_A, DirtyTop, DirtyBottom);
+        DirtyTop = SCREEN_HEIGHT;
+        DirtyBottom = 0;
 #endif
 #endif
 }
@@ -511,30 +576,40 @@ void show_stack(void) {
         MOVE(53, 0);
         PRINTF("stack depth: %d", stack_size());
 #elif defined(NSPIRE)
+		static int panel_shown = 1;
 		int i;
 
-		AllClr_VRAM(VRAM_A);
-		LCD_DispBmp(VRAM_A,0,0,320,24,(uint16_t *)gImage_bar,0xF81F);
-        if (!State2.flags)
+		/* Rows are redrawn over themselves, the panel is only cleared
+		 * when it is hidden.  It is left alone while a program runs and
+		 * catches up on the first display after.
+		 */
+		if (panel_shown && ! State2.flags) {
+			RowsClr_VRAM(VRAM_A, LCD_PANEL_TOP, LCD_PANEL_BOTTOM);
+			lcd_dirty(LCD_PANEL_TOP, LCD_PANEL_BOTTOM);
+			LCD_StrReset();
+			xset(PanelRow, 0, sizeof(PanelRow));
+		}
+		panel_shown = State2.flags;
+        if (!State2.flags || Running)
                 return;
 
         // Stack display smashes the stack registers
 	switch(showpage){
 		case 0:
 			for (i=0; i<4; i++) {
-                dispreg(18,40+24*i,REGNAMES[3-i], regX_idx + 3-i);
+                dispreg(i,REGNAMES[3-i], regX_idx + 3-i);
 			}
 			break;
 		case 1:
 			for (i=4; i<STACK_SIZE; i++) {
-                dispreg(18,40+24*(i-4),REGNAMES[11-i], regX_idx +11-i);
+                dispreg(i-4,REGNAMES[11-i], regX_idx +11-i);
 			}
 			break;
 		case 2:
-			dispreg(18,40,REGNAMES[regK_idx-regX_idx], regK_idx);
-			dispreg(18,40+24,REGNAMES[regJ_idx-regX_idx], regJ_idx);
-			dispreg(18,40+48,REGNAMES[regI_idx-regX_idx], regI_idx);
-			dispreg(18,40+72,REGNAMES[regL_idx-regX_idx], regL_idx);
+			dispreg(0,REGNAMES[regK_idx-regX_idx], regK_idx);
+			dispreg(1,REGNAMES[regJ_idx-regX_idx], regJ_idx);
+			dispreg(2,REGNAMES[regI_idx-regX_idx], regI_idx);
+			dispreg(3,REGNAMES[regL_idx-regX_idx], regL_idx);
 			break;
         //PRINTF("stack depth: %d", stack_size());
 	}
@@ -17,17 +17,251 @@
 #include "matrix.h"
 #include "decn.h"
 #include "consts.h"
-#include "decimal128.h"
+#ifdef MATRIX_HEAP
+#include <os.h>
+#endif
 
 #define MAX_DIMENSION	100
 #define MAX_SQUARE	10
 
+#ifdef MATRIX_HEAP
+#define MAX_ROWS	99	/* rows and columns are two digits in a descriptor */
+#else
+#define MAX_ROWS	MAX_SQUARE
+#endif
+
 static int matrix_idx(int row, int col, int ncols) {
 	return col + row * ncols;
 }
-		
-static void matrix_get(decNumber *r, const decimal64 *base, int row, int col, int ncols) {
-	decimal64ToNumber(base + matrix_idx(row, col, ncols), r);
+
+#ifdef MATRIX_HEAP
+/* Matrices too large for the register file live in a small number of
+ * heap slots.  A descriptor whose base is MATRIX_HEAP_BASE + n refers
+ * to slot n.  The block can be reinterpreted by any descriptor that fits
+ * inside it, just like a register block.  The dimensions recorded here are
+ * those of the largest allocation so that a saved state keeps all of it.
+ */
+static struct {
+	decimal64 *base;
+	int size;
+	unsigned char rows, cols;
+} MatrixHeap[MATRIX_HEAP_SLOTS];
+
+#define is_heap(base)	((base) >= MATRIX_HEAP_BASE)
+
+/* Make sure that *p has room for at least n items of the given size.
+ */
+static int matrix_reserve(void **p, int *have, int n, int size) {
+	void *q;
+
+	if (n <= *have)
+		return 1;
+	q = realloc(*p, n * size);
+	if (q == NULL) {
+		err(ERR_RAM_FULL);
+		return 0;
+	}
+	*p = q;
+	*have = n;
+	return 1;
+}
+
+/* Allocate a heap slot big enough for a rows by cols matrix.
+ * The contents of an existing slot are preserved as far as they fit and
+ * a smaller request leaves the slot as it is.
+ */
+decimal64 *matrix_heap_alloc(int slot, int rows, int cols) {
+	if (slot < 0 || slot >= MATRIX_HEAP_SLOTS || rows <= 0 || cols <= 0 || rows > MAX_ROWS || cols > MAX_ROWS) {
+		err(ERR_RANGE);
+		return NULL;
+	}
+	if (rows * cols > MatrixHeap[slot].size) {
+		if (! matrix_reserve((void **) &MatrixHeap[slot].base, &MatrixHeap[slot].size, rows * cols, sizeof(decimal64)))
+			return NULL;
+		MatrixHeap[slot].rows = rows;
+		MatrixHeap[slot].cols = cols;
+	}
+	return MatrixHeap[slot].base;
+}
+
+/* Return the contents and the dimensions of a heap slot or NULL if
+ * the slot is empty.
+ */
+decimal64 *matrix_heap_slot(int slot, int *rows, int *cols) {
+	if (MatrixHeap[slot].base == NULL)
+		return NULL;
+	*rows = MatrixHeap[slot].rows;
+	*cols = MatrixHeap[slot].cols;
+	return MatrixHeap[slot].base;
+}
+
+static void matrix_heap_free(int slot) {
+	free(MatrixHeap[slot].base);
+	MatrixHeap[slot].base = NULL;
+	MatrixHeap[slot].size = 0;
+}
+
+/* Release every heap matrix.
+ */
+void matrix_heap_clear(void) {
+	int i;
+
+	for (i=0; i<MATRIX_HEAP_SLOTS; i++)
+		matrix_heap_free(i);
+}
+#else
+#define is_heap(base)	0
+#endif
+
+/* Return a pointer to the first element of the matrix at base.
+ */
+static decimal64 *matrix_base(int base) {
+#ifdef MATRIX_HEAP
+	if (is_heap(base))
+		return MatrixHeap[base - MATRIX_HEAP_BASE].base;
+#endif
+	return &(get_reg_n(base)->s);
+}
+
+/* Scratch space for unpacked matrix operands.  Decoding every element
+ * once up front is far cheaper than decoding it each time an inner loop
+ * touches it.
+ */
+static decNumber *matrix_scratch(int n) {
+#ifdef MATRIX_HEAP
+	static decNumber *arena;
+	static int size;
+
+	if (! matrix_reserve((void **) &arena, &size, n, sizeof(decNumber)))
+		return NULL;
+	return arena;
+#else
+	static decNumber arena[2 * MAX_DIMENSION];
+
+	return arena;
+#endif
+}
+
+#ifdef MATRIX_THREADS
+/* A pool of worker threads for the matrix kernels on host builds.
+ * A kernel is handed a range of rows and a context to work in.  The
+ * rows are split into contiguous blocks, one per thread, and every
+ * element is still produced by exactly the same sequence of operations
+ * as in the serial case, so the results don't depend on the number of
+ * threads.  Ctx is shared, so each thread works in its own copy and the
+ * status flags are merged back afterwards.
+ */
+#include <pthread.h>
+
+typedef void (*matrix_kernel)(int lo, int hi, decContext *ctx);
+
+int MatrixThreads = MATRIX_THREADS;
+
+static pthread_mutex_t MatrixLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t MatrixGo = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t MatrixDone = PTHREAD_COND_INITIALIZER;
+
+static struct {
+	int started;
+	int generation;
+	int pending;
+	int threads;
+	int n;
+	matrix_kernel fn;
+	decContext ctx;
+	unsigned int status;
+} MatrixPool;
+
+static void *matrix_worker(void *arg) {
+	const int me = (int) (long) arg;
+	int seen = 0;
+	decContext ctx;
+	matrix_kernel fn;
+	int n, threads;
+
+	for (;;) {
+		pthread_mutex_lock(&MatrixLock);
+		while (MatrixPool.generation == seen)
+			pthread_cond_wait(&MatrixGo, &MatrixLock);
+		seen = MatrixPool.generation;
+		fn = MatrixPool.fn;
+		n = MatrixPool.n;
+		threads = MatrixPool.threads;
+		ctx = MatrixPool.ctx;
+		pthread_mutex_unlock(&MatrixLock);
+
+		if (me >= threads)
+			continue;
+		(*fn)(n * me / threads, n * (me + 1) / threads, &ctx);
+
+		pthread_mutex_lock(&MatrixLock);
+		MatrixPool.status |= ctx.status;
+		if (--MatrixPool.pending == 0)
+			pthread_cond_signal(&MatrixDone);
+		pthread_mutex_unlock(&MatrixLock);
+	}
+	return NULL;
+}
+
+/* Run a kernel over n rows using up to MatrixThreads threads.
+ * The calling thread does the first block itself.
+ */
+static void matrix_parallel(matrix_kernel fn, int n) {
+	int threads = MatrixThreads;
+	decContext ctx;
+	pthread_t id;
+
+	if (threads > MATRIX_THREADS)
+		threads = MATRIX_THREADS;
+	if (threads > n)
+		threads = n;
+	while (threads > 1 && MatrixPool.started < threads - 1) {
+		if (pthread_create(&id, NULL, &matrix_worker, (void *) (long) (MatrixPool.started + 1)) != 0)
+			threads = MatrixPool.started + 1;
+		else {
+			pthread_detach(id);
+			MatrixPool.started++;
+		}
+	}
+	if (threads <= 1) {
+		(*fn)(0, n, &Ctx);
+		return;
+	}
+
+	pthread_mutex_lock(&MatrixLock);
+	MatrixPool.fn = fn;
+	MatrixPool.n = n;
+	MatrixPool.threads = threads;
+	MatrixPool.ctx = Ctx;
+	MatrixPool.ctx.status = 0;
+	MatrixPool.status = 0;
+	MatrixPool.pending = threads - 1;
+	MatrixPool.generation++;
+	pthread_cond_broadcast(&MatrixGo);
+	pthread_mutex_unlock(&MatrixLock);
+
+	ctx = MatrixPool.ctx;
+	(*fn)(0, n / threads, &ctx);
+
+	pthread_mutex_lock(&MatrixLock);
+	while (MatrixPool.pending != 0)
+		pthread_cond_wait(&MatrixDone, &MatrixLock);
+	Ctx.status |= ctx.status | MatrixPool.status;
+	pthread_mutex_unlock(&MatrixLock);
+}
+#else
+#define matrix_parallel(fn, n)	(*(fn))(0, (n), &Ctx)
+#endif
+
+/* Unpack a matrix into a decNumber array.  If transpose is set, the
+ * result is stored column by column so that columns are contiguous.
+ */
+static void matrix_unpack(decNumber *r, const decimal64 *base, int rows, int cols, int transpose) {
+	int i, j;
+
+	for (i=0; i<rows; i++)
+		for (j=0; j<cols; j++)
+			decimal64ToNumber(base++, r + (transpose ? matrix_idx(j, i, rows) : matrix_idx(i, j, cols)));
 }
 
 /* Check if a matrix fits into the available registers or not.
@@ -41,6 +275,16 @@ static int matrix_range_check(int base, int rows, int cols) {
 		err(ERR_BAD_MODE);
 		return 0;
 	}
+#ifdef MATRIX_HEAP
+	if (is_heap(base)) {
+		base -= MATRIX_HEAP_BASE;
+		if (base >= MATRIX_HEAP_SLOTS || rows * cols > MatrixHeap[base].size) {
+			err(ERR_RANGE);
+			return 0;
+		}
+		return 1;
+	}
+#endif
 	if (base >= LOCAL_REG_BASE && LocalRegs < 0) {
 		base -= LOCAL_REG_BASE;
 		limit = local_regs();
@@ -54,10 +298,15 @@ static int matrix_range_check(int base, int rows, int cols) {
 }
 
 /* Build a matrix descriptor from the base, rows and columns.
+ * A heap destination is allocated or resized as required.
  */
 static int matrix_descriptor(decNumber *r, int base, int rows, int cols) {
 	decNumber z;
 
+#ifdef MATRIX_HEAP
+	if (is_heap(base) && matrix_heap_alloc(base - MATRIX_HEAP_BASE, rows, cols) == NULL)
+		return 0;
+#endif
 	if (! matrix_range_check(base, rows, cols))
 		return 0;
 	int_to_dn(&z, (base * 100 + rows) * 100 + cols);
@@ -100,6 +349,19 @@ static int matrix_decompose(const decNumber *x, int *rows, int *cols, int *up) {
 	return base;
 }
 
+/* As above but only accept matrices in registers.  Used by the functions
+ * that hand register numbers back to the user.
+ */
+static int matrix_decompose_reg(const decNumber *x, int *rows, int *cols, int *up) {
+	const int base = matrix_decompose(x, rows, cols, up);
+
+	if (is_heap(base)) {
+		err(ERR_BAD_PARAM);
+		return -1;
+	}
+	return base;
+}
+
 /* Decompose a matrix descriptor and return a pointer to its first
  * element.  Optionally return the number of rows and columns.
  */
@@ -108,7 +370,7 @@ static decimal64 *matrix_decomp(const decNumber *x, int *rows, int *cols) {
 
 	if (base < 0)
 		return NULL;
-	return &(get_reg_n(base)->s);
+	return matrix_base(base);
 }
 
 /* Check if a matrix is square or not.
@@ -166,10 +428,90 @@ decNumber *matrix_copy(decNumber *r, const decNumber *y, const decNumber *x) {
 	d = dn_to_int(x);
 	if (matrix_descriptor(r, d, rows, cols) == 0)
 		return NULL;
-	xcopy(get_reg_n(d), src, rows * cols * sizeof(decimal64));
+	xcopy(matrix_base(d), src, rows * cols * sizeof(decimal64));
 	return r;
 }
 
+#ifdef MATRIX_HEAP
+/* Create a zero matrix.  This is how heap matrices come into being.
+ */
+decNumber *matrix_new(decNumber *r, const decNumber *x) {
+	int rows, cols, base, i;
+	decimal64 *p;
+	const decimal64 *zero = &(get_const(OP_ZERO, 0)->s);
+
+	if (decNumberIsNegative(x)) {
+		err(ERR_BAD_PARAM);
+		return NULL;
+	}
+	dn_mulpow10(r, x, 4);
+	i = dn_to_int(r);
+	base = i / 10000;
+	cols = i % 100;
+	rows = (i / 100) % 100;
+	if (cols == 0)
+		cols = rows;
+	if (matrix_descriptor(r, base, rows, cols) == 0)
+		return NULL;
+	p = matrix_base(base);
+	for (i=0; i<rows*cols; i++)
+		*p++ = *zero;
+	return r;
+}
+
+/* Release the heap slot a descriptor refers to.
+ */
+void matrix_free(enum nilop op) {
+	decNumber x;
+	const int base = matrix_decompose(getX(&x), NULL, NULL, NULL);
+
+	if (base < 0)
+		return;
+	if (! is_heap(base))
+		err(ERR_BAD_PARAM);
+	else
+		matrix_heap_free(base - MATRIX_HEAP_BASE);
+}
+#endif
+
+/* Element access that works for both register and heap matrices.
+ * Both take the matrix in X, the row in Y and the column in Z like M.REG.
+ * M.GET returns that element, M.PUT stores T into it.
+ */
+static decimal64 *matrix_element(const decNumber *cdn, const decNumber *rdn, const decNumber *m) {
+	int h, w, ri, ci;
+	decimal64 *base = matrix_decomp(m, &h, &w);
+
+	if (base == NULL)
+		return NULL;
+	ri = dn_to_int(rdn) - 1;
+	ci = dn_to_int(cdn) - 1;
+	if (ri < 0 || ci < 0 || ri >= h || ci >= w) {
+		err(ERR_RANGE);
+		return NULL;
+	}
+	return base + matrix_idx(ri, ci, w);
+}
+
+decNumber *matrix_get(decNumber *r, const decNumber *cdn, const decNumber *rdn, const decNumber *m) {
+	const decimal64 *p = matrix_element(cdn, rdn, m);
+
+	if (p == NULL)
+		return NULL;
+	decimal64ToNumber(p, r);
+	return r;
+}
+
+void matrix_put(enum nilop op) {
+	decNumber x, y, z, t;
+	decimal64 *p;
+
+	getXYZT(&x, &y, &z, &t);
+	p = matrix_element(&z, &y, &x);
+	if (p != NULL)
+		packed_from_number(p, &t);
+}
+
 
 static decNumber *matrix_do_loop(decNumber *r, int low, int high, int step, int up) {
 	decNumber z;
@@ -188,7 +530,7 @@ static decNumber *matrix_do_loop(decNumber *r, int low, int high, int step, int
 decNumber *matrix_all(decNumber *r, const decNumber *x) {
 	int rows, cols, base, up;
 
-	base = matrix_decompose(x, &rows, &cols, &up);
+	base = matrix_decompose_reg(x, &rows, &cols, &up);
 	if (base < 0)
 		return NULL;
 	return matrix_do_loop(r, base, base+rows*cols-1, 1, up);
@@ -197,7 +539,7 @@ decNumber *matrix_all(decNumber *r, const decNumber *x) {
 decNumber *matrix_diag(decNumber *r, const decNumber *x) {
 	int rows, cols, base, up, n;
 
-	base = matrix_decompose(x, &rows, &cols, &up);
+	base = matrix_decompose_reg(x, &rows, &cols, &up);
 	if (base < 0)
 		return NULL;
 	n = ((rows < cols) ? rows : cols) - 1;
@@ -208,7 +550,7 @@ decNumber *matrix_diag(decNumber *r, const decNumber *x) {
 decNumber *matrix_row(decNumber *r, const decNumber *y, const decNumber *x) {
 	int rows, cols, base, up, n;
 
-	base = matrix_decompose(x, &rows, &cols, &up);
+	base = matrix_decompose_reg(x, &rows, &cols, &up);
 	if (base < 0)
 		return NULL;
 	n = dn_to_int(y) - 1;
@@ -223,7 +565,7 @@ decNumber *matrix_row(decNumber *r, const decNumber *y, const decNumber *x) {
 decNumber *matrix_col(decNumber *r, const decNumber *y, const decNumber *x) {
 	int rows, cols, base, up, n;
 
-	base = matrix_decompose(x, &rows, &cols, &up);
+	base = matrix_decompose_reg(x, &rows, &cols, &up);
 	if (base < 0)
 		return NULL;
 	n = dn_to_int(y) - 1;
@@ -255,7 +597,7 @@ decNumber *matrix_colq(decNumber *r, const decNumber *x) {
 
 decNumber *matrix_getreg(decNumber *r, const decNumber *cdn, const decNumber *rdn, const decNumber *m) {
 	int h, w, ri, ci;
-	int n = matrix_decompose(m, &h, &w, NULL);
+	int n = matrix_decompose_reg(m, &h, &w, NULL);
 
 	if (n < 0)
 		return NULL;
@@ -273,7 +615,7 @@ decNumber *matrix_getreg(decNumber *r, const decNumber *cdn, const decNumber *rd
 decNumber *matrix_getrc(decNumber *res, const decNumber *m) {
 	decNumber ydn;
 	int rows, cols, c, r, pos;
-	int n = matrix_decompose(m, &rows, &cols, NULL);
+	int n = matrix_decompose_reg(m, &rows, &cols, NULL);
 
 	if (n < 0)
 		return NULL;
@@ -317,14 +659,44 @@ decNumber *matrix_genadd(decNumber *r, const decNumber *k, const decNumber *b, c
 }
 
 
+/* The multiply kernel.  Compute rows lo to hi of the product of the
+ * unpacked a (by rows) and b (by columns).
+ */
+static struct {
+	const decNumber *a, *b;
+	decimal64 *c;
+	int inner, cols;
+} MulJob;
+
+static void matrix_multiply_rows(int lo, int hi, decContext *ctx) {
+	decNumber sum, u;
+	const decNumber *ar, *bc;
+	decimal64 *rp = MulJob.c + lo * MulJob.cols;
+	int i, j, k;
+
+	for (i=lo; i<hi; i++) {
+		ar = MulJob.a + i * MulJob.inner;
+		for (j=0; j<MulJob.cols; j++) {
+			bc = MulJob.b + j * MulJob.inner;
+			decNumberZero(&sum);
+			for (k=0; k<MulJob.inner; k++) {
+				decNumberMultiply(&u, ar + k, bc + k, ctx);
+				decNumberAdd(&sum, &sum, &u, ctx);
+			}
+			packed_from_number(rp++, &sum);
+		}
+	}
+}
+
 // Matrix multiply c = a * b, c can be a or b or overlap either
+// Both operands are unpacked once, a by rows and b by columns, and the
+// dot products are accumulated at full working precision.  Since the
+// operands are fully unpacked before c is touched, the result can be
+// written straight to its destination.
 decNumber *matrix_multiply(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *c) {
 	int arows, acols, brows, bcols;
-	decNumber sum, s, t, u;
+	decNumber *at, *bt;
 	int creg;
-	int i, j, k;
-	decimal64 result[MAX_DIMENSION];
-	decimal64 *rp = result;
 	decimal64 *abase = matrix_decomp(a, &arows, &acols);
 	decimal64 *bbase = matrix_decomp(b, &brows, &bcols);
 
@@ -334,23 +706,24 @@ decNumber *matrix_multiply(decNumber *r, const decNumber *a, const decNumber *b,
 		err(ERR_MATRIX_DIM);
 		return NULL;
 	}
-	creg = dn_to_int(c);
-	if (matrix_descriptor(r, creg, arows, bcols) == 0)
+	at = matrix_scratch(arows * acols + brows * bcols);
+	if (at == NULL)
 		return NULL;
+	bt = at + arows * acols;
 
         busy();
-	for (i=0; i<arows; i++)
-		for (j=0; j<bcols; j++) {
-			decNumberZero(&sum);
-			for (k=0; k<acols; k++) {
-				matrix_get(&s, abase, i, k, acols);
-				matrix_get(&t, bbase, k, j, bcols);
-				dn_multiply(&u, &s, &t);
-				dn_add(&sum, &sum, &u);
-			}
-			packed_from_number(rp++, &sum);
-		}
-	xcopy(get_reg_n(creg), result, sizeof(decimal64) * arows * bcols);
+	matrix_unpack(at, abase, arows, acols, 0);
+	matrix_unpack(bt, bbase, brows, bcols, 1);
+
+	creg = dn_to_int(c);
+	if (matrix_descriptor(r, creg, arows, bcols) == 0)
+		return NULL;
+	MulJob.a = at;
+	MulJob.b = bt;
+	MulJob.c = matrix_base(creg);
+	MulJob.inner = acols;
+	MulJob.cols = bcols;
+	matrix_parallel(&matrix_multiply_rows, arows);
 	return r;
 }
 
@@ -362,9 +735,7 @@ decNumber *matrix_transpose(decNumber *r, const decNumber *m) {
 
 	if (n < 0)
 		return NULL;
-	base = &(get_reg_n(n)->s);
-	if (base == NULL)
-		return NULL;
+	base = matrix_base(n);
 
 	for (start=0; start < w*h; start++) {
 		next = start;
@@ -436,37 +807,69 @@ badrow:		err(ERR_RANGE);
 #endif
 
 
-/* Two little utility routines to convert decimal128s to decNumbers and back and to
- * extract elements form a decimal128 matrix.
+/* The most recent LU decomposition.  The matrix is decoded once into
+ * decNumbers and eliminated in place at full working precision.  The
+ * packed source matrix is kept alongside, so that repeated operations on
+ * an unchanged matrix (e.g. several LINEQS with different right hand
+ * sides) reuse the decomposition rather than repeating it.
  */
-static void matrix_get128(decNumber *r, const decimal128 *base, int row, int col, int ncols) {
-	decimal128ToNumber(base + matrix_idx(row, col, ncols), r);
-}
+static struct {
+#ifdef MATRIX_HEAP
+	decimal64 *src;
+	decNumber *lu;
+	int srcsize, lusize;
+#else
+	decimal64 src[MAX_DIMENSION];
+	decNumber lu[MAX_DIMENSION];
+#endif
+	unsigned char pivots[MAX_ROWS];
+	signed char sign;
+	unsigned char n;
+} LUCache;
 
-static void matrix_put128(const decNumber *x, decimal128 *base, int row, int col, int ncols) {
-	packed128_from_number(base + matrix_idx(row, col, ncols), x);
-}
+/* The elimination kernel.  Find the lower triangular element in column
+ * k for each of the given rows below k and update the rest of the row.
+ */
+static struct {
+	decNumber *A;
+	int n, k;
+} LUJob;
+
+static void LU_update_rows(int lo, int hi, decContext *ctx) {
+	const int n = LUJob.n;
+	const int k = LUJob.k;
+	const decNumber *pk = LUJob.A + matrix_idx(k, 0, n);
+	decNumber *pi;
+	decNumber t;
+	int i, j;
 
+	for (i=k+1+lo; i<k+1+hi; i++) {
+		pi = LUJob.A + matrix_idx(i, 0, n);
+		decNumberDivide(pi + k, pi + k, pk + k, ctx);
+		for (j=k+1; j<n; j++) {
+			decNumberMultiply(&t, pi + k, pk + j, ctx);
+			decNumberSubtract(pi + j, pi + j, &t, ctx);
+		}
+	}
+}
 
 /* Perform a LU decomposition of the specified matrix in-situ.
  * Return the pivot rows in pivots if not null and return the parity
  * of the number of pivots or zero if the matrix is singular
  */
-static int LU_decomposition(decimal128 *A, unsigned char *pivots, const int n) {
-	int i, j, k;
+static int LU_decomposition(decNumber *A, unsigned char *pivots, const int n) {
+	int j, k;
 	int pvt, spvt = 1;
-	decimal128 *p1, *p2;
+	decNumber *p1, *p2;
 	decNumber max, t, u;
 
         busy();
 	for (k=0; k<n; k++) {
 		/* Find the pivot row */
 		pvt = k;
-		matrix_get128(&u, A, k, k, n);
-		dn_abs(&max, &u);
+		dn_abs(&max, A + matrix_idx(k, k, n));
 		for (j=k+1; j<n; j++) {
-			matrix_get128(&t, A, j, k, n);
-			dn_abs(&u, &t);
+			dn_abs(&u, A + matrix_idx(j, k, n));
 			if (dn_gt(&u, &max)) {
 				decNumberCopy(&max, &u);
 				pvt = j;
@@ -481,37 +884,23 @@ static int LU_decomposition(decimal128 *A, unsigned char *pivots, const int n) {
 			p1 = A + (n * k);
 			p2 = A + (n * pvt);
 			for (j=0; j<n; j++) {
-				decimal128 t = *p1;
-				*p1 = *p2;
-				*p2 = t;
-				p1++;
-				p2++;
-				//swap_reg(p1++, p2++);
+				t = *p1;
+				*p1++ = *p2;
+				*p2++ = t;
 			}
 		}
 
 		/* Check for singular */
-		matrix_get128(&t, A, k, k, n);
-		if (dn_eq0(&t))
+		if (dn_eq0(A + matrix_idx(k, k, n)))
 			return 0;
 
-		/* Find the lower triangular elements for column k */
-		for (i=k+1; i<n; i++) {
-			matrix_get128(&t, A, k, k, n);
-			matrix_get128(&u, A, i, k, n);
-			dn_divide(&max, &u, &t);
-			matrix_put128(&max, A, i, k, n);
-		}
-		/* Update the upper triangular elements */
-		for (i=k+1; i<n; i++)
-			for (j=k+1; j<n; j++) {
-				matrix_get128(&t, A, i, k, n);
-				matrix_get128(&u, A, k, j, n);
-				dn_multiply(&max, &t, &u);
-				matrix_get128(&t, A, i, j, n);
-				dn_subtract(&u, &t, &max);
-				matrix_put128(&u, A, i, j, n);
-			}
+		/* Find the lower triangular elements for column k and
+		 * update the upper triangular elements of the rows below.
+		 */
+		LUJob.A = A;
+		LUJob.n = n;
+		LUJob.k = k;
+		matrix_parallel(&LU_update_rows, n - k - 1);
 	}
 	return spvt;
 }
@@ -522,9 +911,10 @@ static int LU_decomposition(decimal128 *A, unsigned char *pivots, const int n) {
  * matrix with unity along the diagonal.  Then we solve the linear system
  * Ux = y, where U is the upper triangular matrix.
  */
-static void matrix_pivoting_solve(decimal128 *LU, const decimal64 *b[], unsigned char pivot[], decNumber *x, int n) {
+static void matrix_pivoting_solve(const decNumber *LU, const decimal64 *b[], const unsigned char pivot[], decNumber *x, int n, decContext *ctx) {
 	int i, k;
-	decNumber r, t;
+	const decNumber *row;
+	decNumber t;
 
 	/* Solve the first linear equation Ly = b */
 	for (k=0; k<n; k++) {
@@ -534,41 +924,33 @@ static void matrix_pivoting_solve(decimal128 *LU, const decimal64 *b[], unsigned
 			b[pivot[k]] = swap;
 		}
 		decimal64ToNumber(b[k], x + k);
+		row = LU + matrix_idx(k, 0, n);
 		for (i=0; i<k; i++) {
-			matrix_get128(&r, LU, k, i, n);
-			dn_multiply(&t, &r, x+i);
-			dn_subtract(x+k, x+k, &t);
+			decNumberMultiply(&t, row + i, x+i, ctx);
+			decNumberSubtract(x+k, x+k, &t, ctx);
 		}
 	}
 
 	/* Solve the second linear equation Ux = y */
 	for (k=n-1; k>=0; k--) {
-		//if(k != pivot[k]) swap(b[k], b[pivot[k]]);		// undo pivoting from before
+		row = LU + matrix_idx(k, 0, n);
 		for (i=k+1; i<n; i++) {
-			matrix_get128(&r, LU, k, i, n);
-			dn_multiply(&t, &r, x+i);
-			dn_subtract(x+k, x+k, &t);
+			decNumberMultiply(&t, row + i, x+i, ctx);
+			decNumberSubtract(x+k, x+k, &t, ctx);
 		}
-		matrix_get128(&r, LU, k, k, n);
-#if 0
-		/* Check for singular matrix */
-		if (dn_eq0(&r))
-			return;
-#endif
-		dn_divide(x+k, x+k, &r);
+		decNumberDivide(x+k, x+k, row + k, ctx);
 	}
 }
 
-/* Decompose the passed in matrix identifier and extract the matrix from the
- * associated registers into the passed higher precision matrix.  Optionally,
- * return the first register in the matrix and always return the dimensionality.
- * On error, return 0.
+/* Decompose the passed in matrix identifier and make sure that LUCache
+ * holds the LU decomposition of the associated registers.  Optionally,
+ * return the first register in the matrix and always return the
+ * dimensionality.  On error, return 0.
  */
-static int matrix_lu_check(const decNumber *m, decimal128 *mat, decimal64 **mbase) {
+static int matrix_lu_check(const decNumber *m, decimal64 **mbase) {
 	int rows, cols;
 	decimal64 *base;
-	decNumber t;
-	int i;
+	int i, size;
 
 	base = matrix_decomp(m, &rows, &cols);
 	if (base == NULL)
@@ -577,11 +959,19 @@ static int matrix_lu_check(const decNumber *m, decimal128 *mat, decimal64 **mbas
 		err(ERR_MATRIX_DIM);
 		return 0;
 	}
-	if (mat != NULL) {
-		for (i=0; i<rows*rows; i++) {
-			decimal64ToNumber(base+i, &t);
-			packed128_from_number(mat+i, &t);
-		}
+	size = rows * rows * sizeof(decimal64);
+	if (LUCache.n != rows || xcmp(LUCache.src, base, size) != 0) {
+#ifdef MATRIX_HEAP
+		LUCache.n = 0;
+		if (! matrix_reserve((void **) &LUCache.src, &LUCache.srcsize, rows * rows, sizeof(decimal64))
+				|| ! matrix_reserve((void **) &LUCache.lu, &LUCache.lusize, rows * rows, sizeof(decNumber)))
+			return 0;
+#endif
+		xcopy(LUCache.src, base, size);
+		for (i=0; i<rows*rows; i++)
+			decimal64ToNumber(base+i, LUCache.lu + i);
+		LUCache.sign = LU_decomposition(LUCache.lu, LUCache.pivots, rows);
+		LUCache.n = rows;
 	}
 	if (mbase != NULL)
 		*mbase = base;
@@ -594,21 +984,38 @@ static int matrix_lu_check(const decNumber *m, decimal128 *mat, decimal64 **mbas
  */
 decNumber *matrix_determinant(decNumber *r, const decNumber *m) {
 	int n, i;
-	decimal128 mat[MAX_SQUARE*MAX_SQUARE];
-	decNumber t;
 
-	n = matrix_lu_check(m, mat, NULL);
+	n = matrix_lu_check(m, NULL);
 	if (n == 0)
 		return NULL;
 
-	i = LU_decomposition(mat, NULL, n);
+	int_to_dn(r, LUCache.sign);
+	for (i=0; i<n; i++)
+		dn_multiply(r, r, LUCache.lu + matrix_idx(i, i, n));
+	return r;
+}
 
-	int_to_dn(r, i);
-	for (i=0; i<n; i++) {
-		matrix_get128(&t, mat, i, i, n);
-		dn_multiply(r, r, &t);
+/* The inversion kernel.  Solve for columns lo to hi of the inverse.
+ */
+static struct {
+	decimal64 *base;
+	const decimal64 *one, *zero;
+	int n;
+} InvJob;
+
+static void matrix_inverse_cols(int lo, int hi, decContext *ctx) {
+	decNumber x[MAX_ROWS];
+	const decimal64 *b[MAX_ROWS];
+	const int n = InvJob.n;
+	int i, j;
+
+	for (i=lo; i<hi; i++) {
+		for (j=0; j<n; j++)
+			b[j] = (i==j) ? InvJob.one : InvJob.zero;
+		matrix_pivoting_solve(LUCache.lu, b, LUCache.pivots, x, n, ctx);
+		for (j=0; j<n; j++)
+			packed_from_number(InvJob.base + matrix_idx(j, i, n), x+j);
 	}
-	return r;
 }
 
 /* Invert a matrix in situ.
@@ -616,93 +1023,530 @@ decNumber *matrix_determinant(decNumber *r, const decNumber *m) {
  * of linear equations.
  */
 void matrix_inverse(enum nilop op) {
-	decimal128 mat[MAX_SQUARE*MAX_SQUARE];
-	decNumber x[MAX_SQUARE];
-	unsigned char pivots[MAX_SQUARE];
-	int i, j, n;
-	decimal64 *base;
-	const decimal64 *b[MAX_SQUARE];
+	decNumber x;
+	int n;
 
-	getX(x);
-	n = matrix_lu_check(x, mat, &base);
+	getX(&x);
+	n = matrix_lu_check(&x, &InvJob.base);
 	if (n == 0)
 		return;
 
-	i = LU_decomposition(mat, pivots, n);
-	if (i == 0) {
+	if (LUCache.sign == 0) {
 		err(ERR_SINGULAR);
 		return;
 	}
 
-	for (i=0; i<n; i++) {
-		for (j=0; j<n; j++)
-			b[j] = (i==j) ? (decimal64 *) get_const(OP_ONE, 0) : (decimal64 *) get_const(OP_ZERO, 0);
-		matrix_pivoting_solve(mat, b, pivots, x, n);
-		for (j=0; j<n; j++)
-			packed_from_number(base + matrix_idx(j, i, n), x+j);
+	InvJob.one = &(get_const(OP_ONE, 0)->s);
+	InvJob.zero = &(get_const(OP_ZERO, 0)->s);
+	InvJob.n = n;
+	matrix_parallel(&matrix_inverse_cols, n);
+}
+
+/* Check the right hand side and the destination of a linear solve.
+ * The right hand side must be a column vector of brows elements and
+ * the solution, a column vector of n elements, goes to register c.
+ */
+static int matrix_solve_args(decNumber *r, const decNumber *b, const decNumber *c, int brows, int n, decimal64 **bbase, decimal64 **cbase) {
+	int rows, cols, creg;
+
+	*bbase = matrix_decomp(b, &rows, &cols);
+	if (*bbase == NULL)
+		return 0;
+	if (rows != brows || cols != 1) {
+		err(ERR_MATRIX_DIM);
+		return 0;
 	}
+
+	creg = dn_to_int(c);
+	if (matrix_descriptor(r, creg, n, 1) == 0)
+		return 0;
+	*cbase = matrix_base(creg);
+	return 1;
 }
 
 /* Solve a system of linear equations Ac = b
  */
 decNumber *matrix_linear_eqn(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *c) {
-	int n, i, brows, bcols, creg;
-	decimal128 mat[MAX_SQUARE*MAX_SQUARE];
+	int n, i;
 	decimal64 *bbase, *cbase;
-	decNumber cv[MAX_SQUARE];
-	unsigned char pivots[MAX_SQUARE];
-	const decimal64 *bv[MAX_SQUARE];
+	decNumber cv[MAX_ROWS];
+	const decimal64 *bv[MAX_ROWS];
 
-	n = matrix_lu_check(a, mat, NULL);
-	if (n == 0)
+	n = matrix_lu_check(a, NULL);
+	if (n == 0 || ! matrix_solve_args(r, b, c, n, n, &bbase, &cbase))
 		return NULL;
 
-	bbase = matrix_decomp(b, &brows, &bcols);
-	if (bbase == NULL)
+	/* Everything is happy so far -- check the decomposition */
+	if (LUCache.sign == 0) {
+		err(ERR_SINGULAR);
 		return NULL;
-	if (brows != n || bcols != 1) {
+	}
+
+	/* And solve */
+	for (i=0; i<n; i++)
+		bv[i] = bbase + i;
+	matrix_pivoting_solve(LUCache.lu, bv, LUCache.pivots, cv, n, &Ctx);
+	for (i=0; i<n; i++)
+		packed_from_number(cbase+i, cv+i);
+	return r;
+}
+
+#ifdef MATRIX_FACTOR
+/* Cholesky decomposition of a symmetric positive definite matrix in the
+ * square root free form A = L D L^T.  It needs half the work of the LU
+ * decomposition and no pivoting.  L, with a unit diagonal, replaces the
+ * lower triangle and D the diagonal.  The upper triangle is used for
+ * the partial products L D.  The kernel finds column j of L for the
+ * given rows below j.
+ */
+static struct {
+	decNumber *A;
+	int n, j;
+} CholJob;
+
+static void cholesky_update_rows(int lo, int hi, decContext *ctx) {
+	const int n = CholJob.n;
+	const int j = CholJob.j;
+	decNumber *A = CholJob.A;
+	decNumber *pi;
+	decNumber t;
+	int i, k;
+
+	for (i=j+1+lo; i<j+1+hi; i++) {
+		pi = A + matrix_idx(i, 0, n);
+		for (k=0; k<j; k++) {
+			decNumberMultiply(&t, pi + k, A + matrix_idx(k, j, n), ctx);
+			decNumberSubtract(pi + j, pi + j, &t, ctx);
+		}
+		decNumberCopy(A + matrix_idx(j, i, n), pi + j);
+		decNumberDivide(pi + j, pi + j, A + matrix_idx(j, j, n), ctx);
+	}
+}
+
+/* Perform the decomposition in-situ.  Return zero if the matrix isn't
+ * positive definite.
+ */
+static int cholesky_decomposition(decNumber *A, const int n) {
+	decNumber *pj;
+	decNumber t;
+	int j, k;
+
+	busy();
+	for (j=0; j<n; j++) {
+		pj = A + matrix_idx(j, 0, n);
+		for (k=0; k<j; k++) {
+			dn_multiply(&t, pj + k, A + matrix_idx(k, j, n));
+			dn_subtract(pj + j, pj + j, &t);
+		}
+		if (dn_le0(pj + j))
+			return 0;
+
+		CholJob.A = A;
+		CholJob.n = n;
+		CholJob.j = j;
+		matrix_parallel(&cholesky_update_rows, n - j - 1);
+	}
+	return 1;
+}
+
+/* Decode a matrix, check that it is symmetric and factor it.  Return
+ * the dimension and the factors in scratch space or zero on error.
+ */
+static int matrix_cholesky_check(const decNumber *m, decNumber **LD, decimal64 **mbase) {
+	int n, cols, i, j;
+	decimal64 *base;
+	decNumber *A;
+
+	base = matrix_decomp(m, &n, &cols);
+	if (base == NULL)
+		return 0;
+	if (n != cols) {
 		err(ERR_MATRIX_DIM);
+		return 0;
+	}
+	A = matrix_scratch(n * n);
+	if (A == NULL)
+		return 0;
+	matrix_unpack(A, base, n, n, 0);
+	for (i=1; i<n; i++)
+		for (j=0; j<i; j++)
+			if (! dn_eq(A + matrix_idx(i, j, n), A + matrix_idx(j, i, n))) {
+				err(ERR_DOMAIN);
+				return 0;
+			}
+	if (! cholesky_decomposition(A, n)) {
+		err(ERR_DOMAIN);
+		return 0;
+	}
+	*LD = A;
+	if (mbase != NULL)
+		*mbase = base;
+	return n;
+}
+
+/* Replace a symmetric positive definite matrix by its Cholesky factor
+ * L D^1/2 so that A = L L^T.  The elements above the diagonal are cleared.
+ */
+decNumber *matrix_cholesky(decNumber *r, const decNumber *m) {
+	const decimal64 *zero = &(get_const(OP_ZERO, 0)->s);
+	decNumber d[MAX_ROWS];
+	decNumber *LD;
+	decNumber t;
+	decimal64 *base;
+	int n, i, j;
+
+	n = matrix_cholesky_check(m, &LD, &base);
+	if (n == 0)
 		return NULL;
+
+	for (j=0; j<n; j++)
+		dn_sqrt(d + j, LD + matrix_idx(j, j, n));
+	for (i=0; i<n; i++)
+		for (j=0; j<n; j++, base++)
+			if (j > i)
+				*base = *zero;
+			else if (j == i)
+				packed_from_number(base, d + j);
+			else
+				packed_from_number(base, dn_multiply(&t, LD + matrix_idx(i, j, n), d + j));
+	return decNumberCopy(r, m);
+}
+
+/* Solve L D L^T x = b in place, b being passed in x.  Solve Ly = b,
+ * then scale by D and solve L^T x = D^-1 y.
+ */
+static void cholesky_solve(const decNumber *LD, decNumber *x, int n) {
+	const decNumber *row;
+	decNumber t;
+	int i, k;
+
+	for (k=0; k<n; k++) {
+		row = LD + matrix_idx(k, 0, n);
+		for (i=0; i<k; i++) {
+			dn_multiply(&t, row + i, x + i);
+			dn_subtract(x + k, x + k, &t);
+		}
 	}
+	for (k=n-1; k>=0; k--) {
+		dn_divide(x + k, x + k, LD + matrix_idx(k, k, n));
+		for (i=k+1; i<n; i++) {
+			dn_multiply(&t, LD + matrix_idx(i, k, n), x + i);
+			dn_subtract(x + k, x + k, &t);
+		}
+	}
+}
 
-	creg = dn_to_int(c);
-	if (matrix_descriptor(r, creg, n, 1) == 0)
+/* Solve Ac = b for a symmetric positive definite A.
+ */
+decNumber *matrix_spd_eqn(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *c) {
+	decNumber x[MAX_ROWS];
+	decNumber *LD;
+	decimal64 *bbase, *cbase;
+	int n, k;
+
+	n = matrix_cholesky_check(a, &LD, NULL);
+	if (n == 0 || ! matrix_solve_args(r, b, c, n, n, &bbase, &cbase))
+		return NULL;
+
+	matrix_unpack(x, bbase, n, 1, 0);
+	cholesky_solve(LD, x, n);
+	for (k=0; k<n; k++)
+		packed_from_number(cbase + k, x + k);
+	return r;
+}
+
+/* Multiple linear regression of the response vector in Y on the
+ * columns of the n by p design matrix in Z.  Include a column of ones
+ * for an intercept.  A single pass over the rows, each unpacked once,
+ * accumulates the lower triangle of X^T X, X^T y and the sums of y and
+ * y^2, so the data is never unpacked as a whole.  The normal equations
+ * square the condition number, but at full working precision they still
+ * give register precision results while the condition of the design is
+ * below about 10^11.  They are solved with the Cholesky factorisation.
+ * The coefficients go to the vector starting at the register in X and
+ * its descriptor is returned in X, R^2 in Y and the residual variance
+ * in Z.
+ */
+void matrix_mlr(enum nilop op) {
+	decNumber xv[MAX_ROWS], c[MAX_ROWS];
+	decNumber *A, *row;
+	decNumber x, y, z, sy, syy, sse, sst, t;
+	decimal64 *abase, *bbase, *cbase;
+	int n, p, i, j, k;
+
+	getXYZ(&x, &y, &z);
+	abase = matrix_decomp(&z, &n, &p);
+	if (abase == NULL)
+		return;
+	if (n <= p) {
+		err(ERR_MATRIX_DIM);
+		return;
+	}
+	if (! matrix_solve_args(&x, &y, &x, n, p, &bbase, &cbase))
+		return;
+	A = matrix_scratch(p * p);
+	if (A == NULL)
+		return;
+
+	busy();
+	for (i=0; i<p*p; i++)
+		decNumberZero(A + i);
+	for (j=0; j<p; j++)
+		decNumberZero(c + j);
+	decNumberZero(&sy);
+	decNumberZero(&syy);
+	for (i=0; i<n; i++) {
+		matrix_unpack(xv, abase + i * p, 1, p, 0);
+		decimal64ToNumber(bbase + i, &y);
+		for (j=0; j<p; j++) {
+			row = A + matrix_idx(j, 0, p);
+			for (k=0; k<=j; k++) {
+				dn_multiply(&t, xv + j, xv + k);
+				dn_add(row + k, row + k, &t);
+			}
+			dn_multiply(&t, xv + j, &y);
+			dn_add(c + j, c + j, &t);
+		}
+		dn_add(&sy, &sy, &y);
+		dn_multiply(&t, &y, &y);
+		dn_add(&syy, &syy, &t);
+	}
+
+	/* SSE = y^T y - c^T X^T y, SST = y^T y - (sum y)^2 / n */
+	decNumberCopy(&sse, &syy);
+	for (j=0; j<p; j++)
+		decNumberCopy(xv + j, c + j);
+	if (! cholesky_decomposition(A, p)) {
+		err(ERR_SINGULAR);
+		return;
+	}
+	cholesky_solve(A, c, p);
+	for (j=0; j<p; j++) {
+		dn_multiply(&t, c + j, xv + j);
+		dn_subtract(&sse, &sse, &t);
+	}
+	dn_multiply(&t, &sy, &sy);
+	int_to_dn(&z, n);
+	dn_divide(&y, &t, &z);
+	dn_subtract(&sst, &syy, &y);
+	if (dn_le0(&sst)) {
+		err(ERR_DOMAIN);
+		return;
+	}
+
+	for (j=0; j<p; j++)
+		packed_from_number(cbase + j, c + j);
+	setlastX();
+	dn_divide(&t, &sse, &sst);
+	dn_1m(&y, &t);
+	int_to_dn(&t, n - p);
+	dn_divide(&z, &sse, &t);
+	setXYZ(&x, &y, &z);
+}
+
+/* Householder QR.  The matrix is held column by column with the right
+ * hand side appended as an extra column.  The kernel applies the
+ * reflection H = I - v v^T / h held in column k to the given columns
+ * to the right of k.
+ */
+static struct {
+	decNumber *A;
+	const decNumber *h;
+	int m, k;
+} QRJob;
+
+static void qr_reflect_cols(int lo, int hi, decContext *ctx) {
+	const int m = QRJob.m;
+	const int k = QRJob.k;
+	const decNumber *v = QRJob.A + matrix_idx(k, 0, m);
+	decNumber *cj;
+	decNumber s, t;
+	int i, j;
+
+	for (j=k+1+lo; j<k+1+hi; j++) {
+		cj = QRJob.A + matrix_idx(j, 0, m);
+		decNumberZero(&s);
+		for (i=k; i<m; i++) {
+			decNumberMultiply(&t, v + i, cj + i, ctx);
+			decNumberAdd(&s, &s, &t, ctx);
+		}
+		decNumberDivide(&s, &s, QRJob.h, ctx);
+		for (i=k; i<m; i++) {
+			decNumberMultiply(&t, v + i, &s, ctx);
+			decNumberSubtract(cj + i, cj + i, &t, ctx);
+		}
+	}
+}
+
+/* Solve the possibly over determined system Ac = b in the least squares
+ * sense.  The reflections are applied to b as they are generated so Q
+ * is never formed, then Rc = Q^T b is solved by back substitution.
+ */
+decNumber *matrix_lsq_eqn(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *c) {
+	decNumber x[MAX_ROWS];
+	decNumber *A, *ck, *qb;
+	decNumber alpha, h, s, t;
+	decimal64 *abase, *bbase, *cbase;
+	int m, n, i, k;
+
+	abase = matrix_decomp(a, &m, &n);
+	if (abase == NULL)
+		return NULL;
+	if (m < n) {
+		err(ERR_MATRIX_DIM);
+		return NULL;
+	}
+	if (! matrix_solve_args(r, b, c, m, n, &bbase, &cbase))
+		return NULL;
+	A = matrix_scratch(m * (n + 1));
+	if (A == NULL)
 		return NULL;
-	cbase = &(get_reg_n(creg)->s);
+	qb = A + matrix_idx(n, 0, m);
+	matrix_unpack(A, abase, m, n, 1);
+	matrix_unpack(qb, bbase, m, 1, 0);
 
-	/* Everything is happy so far -- decompose */
-	i = LU_decomposition(mat, pivots, n);
-	if (i == 0) {
+	busy();
+	for (k=0; k<n; k++) {
+		ck = A + matrix_idx(k, 0, m);
+		decNumberZero(&s);
+		for (i=k; i<m; i++) {
+			dn_multiply(&t, ck + i, ck + i);
+			dn_add(&s, &s, &t);
+		}
+		if (dn_eq0(&s)) {
+			err(ERR_SINGULAR);
+			return NULL;
+		}
+
+		/* alpha = -sign(akk) |x|, v = x - alpha e1 and v^T v = 2h */
+		dn_sqrt(&alpha, &s);
+		if (! decNumberIsNegative(ck + k))
+			dn_minus(&alpha, &alpha);
+		dn_subtract(&t, &alpha, ck + k);
+		dn_multiply(&h, &alpha, &t);
+		dn_subtract(ck + k, ck + k, &alpha);
+
+		QRJob.A = A;
+		QRJob.h = &h;
+		QRJob.m = m;
+		QRJob.k = k;
+		matrix_parallel(&qr_reflect_cols, n - k);
+		decNumberCopy(ck + k, &alpha);
+	}
+
+	for (k=n-1; k>=0; k--) {
+		decNumberCopy(x + k, qb + k);
+		for (i=k+1; i<n; i++) {
+			dn_multiply(&t, A + matrix_idx(i, k, m), x + i);
+			dn_subtract(x + k, x + k, &t);
+		}
+		dn_divide(x + k, x + k, A + matrix_idx(k, k, m));
+	}
+	for (k=0; k<n; k++)
+		packed_from_number(cbase + k, x + k);
+	return r;
+}
+
+/* Solve Ac = b by mixed precision iterative refinement.  The LU
+ * decomposition and the corrections are done at the sixteen digits of a
+ * register, which is quicker than full working precision, while the
+ * residuals b - Ac are formed at full working precision.  A few steps
+ * give a solution correct to single precision even for badly
+ * conditioned systems.  Stop once the stored result no longer changes.
+ * If that doesn't happen the system is too ill conditioned for sixteen
+ * digits and we fall back to the full precision LU solve.
+ */
+#define MATRIX_REFINE_STEPS	6
+
+decNumber *matrix_refine_eqn(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *c) {
+	decNumber x[MAX_ROWS], d[MAX_ROWS];
+	decimal64 bv[MAX_ROWS], rv[MAX_ROWS], xv[MAX_ROWS];
+	const decimal64 *dv[MAX_ROWS];
+	unsigned char pivots[MAX_ROWS];
+	decNumber *A, *LU;
+	decNumber res, t;
+	decimal64 *abase, *bbase, *cbase;
+	decContext ctx16;
+	int n, cols, i, j, k, digits;
+
+	abase = matrix_decomp(a, &n, &cols);
+	if (abase == NULL)
+		return NULL;
+	if (n != cols) {
+		err(ERR_MATRIX_DIM);
+		return NULL;
+	}
+	if (! matrix_solve_args(r, b, c, n, n, &bbase, &cbase))
+		return NULL;
+	A = matrix_scratch(2 * n * n);
+	if (A == NULL)
+		return NULL;
+	LU = A + n * n;
+	matrix_unpack(A, abase, n, n, 0);
+	for (i=0; i<n*n; i++)
+		decNumberCopy(LU + i, A + i);
+	xcopy(bv, bbase, n * sizeof(decimal64));
+
+	digits = Ctx.digits;
+	Ctx.digits = DECIMAL64_Pmax;
+	ctx16 = Ctx;
+	k = LU_decomposition(LU, pivots, n);
+	Ctx.digits = digits;
+	if (k == 0) {
 		err(ERR_SINGULAR);
 		return NULL;
 	}
 
-	/* And solve */
 	for (i=0; i<n; i++)
-		bv[i] = bbase + i;
-	matrix_pivoting_solve(mat, bv, pivots, cv, n);
+		dv[i] = bv + i;
+	matrix_pivoting_solve(LU, dv, pivots, x, n, &ctx16);
 	for (i=0; i<n; i++)
-		packed_from_number(cbase+i, cv+i);
-	return r;
+		packed_from_number(xv + i, x + i);
+
+	for (k=0; k<MATRIX_REFINE_STEPS; k++) {
+		for (i=0; i<n; i++) {
+			decimal64ToNumber(bv + i, &res);
+			for (j=0; j<n; j++) {
+				dn_multiply(&t, A + matrix_idx(i, j, n), x + j);
+				dn_subtract(&res, &res, &t);
+			}
+			packed_from_number(rv + i, &res);
+			dv[i] = rv + i;
+		}
+		matrix_pivoting_solve(LU, dv, pivots, d, n, &ctx16);
+		for (i=0; i<n; i++) {
+			dn_add(x + i, x + i, d + i);
+			packed_from_number(rv + i, x + i);
+		}
+		if (xcmp(rv, xv, n * sizeof(decimal64)) == 0) {
+			xcopy(cbase, xv, n * sizeof(decimal64));
+			return r;
+		}
+		xcopy(xv, rv, n * sizeof(decimal64));
+	}
+	return matrix_linear_eqn(r, a, b, c);
 }
+#endif
 
 #ifdef MATRIX_LU_DECOMP
 /* Perform an in-situ LU decomposition of a user's matrix.
  * Return the pivot descriptor.
  */
 decNumber *matrix_lu_decomp(decNumber *r, const decNumber *m) {
-	unsigned char pivots[MAX_SQUARE];
-	int i, sign, n;
+	int i, n;
 	decNumber t, u;
-	decimal128 mat[MAX_SQUARE*MAX_SQUARE];
 	decimal64 *base;
 
-	n = matrix_lu_check(m, mat, &base);
+	n = matrix_lu_check(m, &base);
 	if (n == 0)
 		return NULL;
 
-	sign = LU_decomposition(mat, pivots, n);
-	if (sign == 0) {
+	/* The pivot number holds a single digit per row */
+	if (n > MAX_SQUARE) {
+		err(ERR_RANGE);
+		return NULL;
+	}
+	if (LUCache.sign == 0) {
 		err(ERR_SINGULAR);
 		return NULL;
 	}
@@ -710,15 +1554,14 @@ decNumber *matrix_lu_decomp(decNumber *r, const decNumber *m) {
 	/* Build the pivot number */
 	decNumberZero(r);
 	for (i=0; i<n; i++) {
-		int_to_dn(&t, pivots[i]);
+		int_to_dn(&t, LUCache.pivots[i]);
 		dn_mulpow10(&u, r, 1);
 		dn_add(r, &u, &t);
 	}
 
 	/* Copy the result back over the matrix */
-	for (i=0; i<n*n; i++) {
-		packed_from_packed128(base+i, mat+i);
-	}
+	for (i=0; i<n*n; i++)
+		packed_from_number(base+i, LUCache.lu + i);
 	return r;
 }
 #endif
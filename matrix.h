@@ -34,10 +34,32 @@ extern void matrix_rowops(enum nilop op);
 extern void matrix_is_square(enum nilop op);
 extern void matrix_create(enum nilop op);
 extern decNumber *matrix_copy(decNumber *r, const decNumber *y, const decNumber *x);
+extern decNumber *matrix_get(decNumber *r, const decNumber *k, const decNumber *b, const decNumber *a);
+extern void matrix_put(enum nilop op);
+
+#ifdef MATRIX_HEAP
+extern decNumber *matrix_new(decNumber *r, const decNumber *x);
+extern void matrix_free(enum nilop op);
+extern decimal64 *matrix_heap_alloc(int slot, int rows, int cols);
+extern decimal64 *matrix_heap_slot(int slot, int *rows, int *cols);
+extern void matrix_heap_clear(void);
+#endif
+
+#ifdef MATRIX_THREADS
+extern int MatrixThreads;
+#endif
 
 extern decNumber *matrix_determinant(decNumber *r, const decNumber *x);
 extern decNumber *matrix_lu_decomp(decNumber *r, const decNumber *x);
 extern void matrix_inverse(enum nilop op);
 extern decNumber *matrix_linear_eqn(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *c);
 
+#ifdef MATRIX_FACTOR
+extern decNumber *matrix_cholesky(decNumber *r, const decNumber *m);
+extern decNumber *matrix_spd_eqn(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *c);
+extern decNumber *matrix_lsq_eqn(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *c);
+extern decNumber *matrix_refine_eqn(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *c);
+extern void matrix_mlr(enum nilop op);
+#endif
+
 #endif
@@ -0,0 +1,327 @@
+/* This file is part of 34S.
+ *
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Polynomials held in a register block sss.nn in X, leading coefficient
+ * first so the block a[0] .. a[n-1] is a[0] x^(n-1) + ... + a[n-1].
+ * Everything is carried out at the full internal precision and only
+ * rounded when the results are stored.
+ */
+
+#include "poly.h"
+#include "decn.h"
+#include "complex.h"
+#include "consts.h"
+
+#include <os.h>
+
+#define POLY_ITER	100		/* Root finder sweeps before giving up */
+
+/* Evaluate the polynomial in the block blk and optionally its derivative
+ * at x using Horner's scheme, reading the coefficients straight out of
+ * the registers.
+ */
+static int poly_horner(decNumber *p, decNumber *dp, const decNumber *x, const decNumber *blk) {
+	decNumber a, t;
+	int s, n, i;
+
+	if (reg_decode_dn(blk, &s, &n, NULL, 0))
+		return 1;
+	getRegister(p, s);
+	if (dp != NULL)
+		decNumberZero(dp);
+	for (i=1; i<n; i++) {
+		if (dp != NULL) {
+			dn_multiply(&t, dp, x);
+			dn_add(dp, &t, p);
+		}
+		getRegister(&a, s + i);
+		dn_multiply(&t, p, x);
+		dn_add(p, &t, &a);
+	}
+	return 0;
+}
+
+/* Real p(x) with x in Y and the block in X.
+ */
+decNumber *poly_eval(decNumber *r, const decNumber *x, const decNumber *blk) {
+	if (poly_horner(r, NULL, x, blk))
+		return NULL;
+	return r;
+}
+
+/* Complex p(z) with z in Z + i T and the block in X.  The descriptor is
+ * the real part c of the complex X, its imaginary part d is not used.
+ */
+void cpx_poly_eval(decNumber *rx, decNumber *ry,
+			const decNumber *a, const decNumber *b,
+			const decNumber *c, const decNumber *d) {
+	decNumber k, tr, ti;
+	int s, n, i;
+
+	if (reg_decode_dn(c, &s, &n, NULL, 0)) {
+		set_NaN(rx);
+		set_NaN(ry);
+		return;
+	}
+	getRegister(rx, s);
+	decNumberZero(ry);
+	for (i=1; i<n; i++) {
+		getRegister(&k, s + i);
+		cmplxMultiply(&tr, &ti, rx, ry, a, b);
+		dn_add(rx, &tr, &k);
+		decNumberCopy(ry, &ti);
+	}
+}
+
+/* p(x) and p'(x) from a single pass with x in Y and the block in X.
+ * The value replaces X and the derivative Y.
+ */
+void poly_deriv(enum nilop op) {
+	decNumber x, blk, p, dp;
+
+	getXY(&blk, &x);
+	if (poly_horner(&p, &dp, &x, &blk))
+		return;
+	setlastX();
+	setXY(&p, &dp);
+}
+
+/* Complex Horner for the root finder: value, derivative and a bound on
+ * the rounding error of the value from the absolute coefficients.
+ */
+static void poly_chorner(decNumber *pr, decNumber *pi, decNumber *dr, decNumber *di, decNumber *e,
+			const decNumber *a, const decNumber *ab, int n,
+			const decNumber *zr, const decNumber *zi) {
+	decNumber tr, ti, m;
+	int i;
+
+	cmplxR(&m, zr, zi);
+	decNumberCopy(pr, a);
+	decNumberZero(pi);
+	decNumberZero(dr);
+	decNumberZero(di);
+	decNumberCopy(e, ab);
+	for (i=1; i<n; i++) {
+		cmplxMultiply(&tr, &ti, dr, di, zr, zi);
+		dn_add(dr, &tr, pr);
+		dn_add(di, &ti, pi);
+		cmplxMultiply(&tr, &ti, pr, pi, zr, zi);
+		dn_add(pr, &tr, a + i);
+		decNumberCopy(pi, &ti);
+		dn_multiply(&tr, e, &m);
+		dn_add(e, &tr, ab + i);
+	}
+}
+
+/* Squared modulus and reciprocal with a single division for the root finder.
+ */
+static decNumber *poly_norm(decNumber *r, const decNumber *a, const decNumber *b) {
+	decNumber t, u;
+
+	dn_multiply(&t, a, a);
+	dn_multiply(&u, b, b);
+	return dn_add(r, &t, &u);
+}
+
+static void poly_recip(decNumber *rx, decNumber *ry, const decNumber *a, const decNumber *b) {
+	decNumber t, q;
+
+	decNumberRecip(&q, poly_norm(&t, a, b));
+	dn_multiply(rx, a, &q);
+	dn_multiply(&t, b, &q);
+	dn_minus(ry, &t);
+}
+
+/* Check that the destination for n registers is a real register range.
+ */
+static int poly_dest(const decNumber *x, int n) {
+	int base, limit = global_regs();
+
+	if (! is_int(x)) {
+		err(ERR_DOMAIN);
+		return -1;
+	}
+	base = dn_to_int(x);
+	if (base >= LOCAL_REG_BASE) {
+		base -= LOCAL_REG_BASE;
+		limit = local_regs();
+	}
+	if (base < 0 || base + n > limit) {
+		err(ERR_RANGE);
+		return -1;
+	}
+	return dn_to_int(x);
+}
+
+/* All the roots of the polynomial in the block in X by Aberth-Ehrlich
+ * iteration.  Y holds the first of the registers that receive the real
+ * and imaginary parts of each root in turn, sorted by real then imaginary
+ * part.  The result is the descriptor of these registers.
+ *
+ * Leading zero coefficients are dropped and trailing ones become exact
+ * zero roots.  The remaining roots start spread on a circle around their
+ * centroid with radius the geometric mean of their moduli and each is
+ * updated in place by
+ *	w = 1 / (p'/p - sum 1 / (z - z[j]))
+ * until either the correction is negligible or p(z) is within the rounding
+ * error of its evaluation.  Moduli are compared squared to save square roots.
+ * With real coefficients, real or imaginary parts lost in this noise are
+ * set to zero.
+ */
+decNumber *poly_roots(decNumber *r, const decNumber *dest, const decNumber *blk) {
+	decNumber *a, *ab, *zr, *zi;
+	unsigned char *done;
+	decNumber pr, pi, dr, di, e, sr, si, tr, ti, u, v, rad, cr, theta, step, tol, eps2;
+	int s, n, deg, m, base, i, j, it, active;
+
+	if (reg_decode_dn(blk, &s, &n, NULL, 0))
+		return NULL;
+	if (n > POLY_MAX) {
+		err(ERR_RANGE);
+		return NULL;
+	}
+	a = malloc(n * (4 * sizeof(decNumber) + 1));
+	if (a == NULL) {
+		err(ERR_RAM_FULL);
+		return NULL;
+	}
+	ab = a + n;
+	zr = ab + n;
+	zi = zr + n;
+	done = (unsigned char *) (zi + n);
+
+	for (i=j=0; i<n; i++) {
+		getRegister(a + j, s + i);
+		if (j > 0 || ! dn_eq0(a + j))
+			j++;
+	}
+	deg = j - 1;
+	if (deg < 1) {
+		err(ERR_DOMAIN);
+		goto out;
+	}
+	base = poly_dest(dest, 2 * deg);
+	if (base < 0)
+		goto out;
+
+	for (m = deg; dn_eq0(a + m); m--) {
+		decNumberZero(zr + m - 1);
+		decNumberZero(zi + m - 1);
+	}
+	for (i=0; i<=m; i++)
+		dn_abs(ab + i, a + i);
+	int_to_dn(&u, m);
+	dn_multiply(&tol, &u, &const_1e_37);
+	dn_multiply(&eps2, &const_1e_32, &const_1e_32);
+
+	if (m > 0) {
+		int_to_dn(&u, m);
+		dn_multiply(&v, &u, a);
+		dn_divide(&cr, a + 1, &v);
+		dn_minus(&cr, &cr);
+		dn_divide(&v, ab + m, ab);
+		decNumberRecip(&tr, &u);
+		dn_power(&rad, &v, &tr);
+		dn_divide(&step, &const_2PI, &u);
+		decNumberCopy(&theta, &const_0_5);
+		for (i=0; i<m; i++) {
+			dn_sincos(&theta, &v, &u);
+			dn_multiply(&tr, &u, &rad);
+			dn_add(zr + i, &tr, &cr);
+			dn_multiply(zi + i, &v, &rad);
+			dn_add(&theta, &theta, &step);
+			done[i] = 0;
+		}
+	}
+
+	for (it=0; it<POLY_ITER; it++) {
+		active = 0;
+		for (i=0; i<m; i++) {
+			if (done[i])
+				continue;
+			poly_chorner(&pr, &pi, &dr, &di, &e, a, ab, m + 1, zr + i, zi + i);
+			poly_norm(&u, &pr, &pi);
+			dn_multiply(&v, &e, &tol);
+			dn_multiply(&tr, &v, &v);
+			if (dn_le(&u, &tr)) {
+				done[i] = 1;
+				continue;
+			}
+			cmplxDivide(&sr, &si, &dr, &di, &pr, &pi);
+			for (j=0; j<m; j++)
+				if (j != i) {
+					dn_subtract(&tr, zr + i, zr + j);
+					dn_subtract(&ti, zi + i, zi + j);
+					poly_recip(&u, &v, &tr, &ti);
+					dn_subtract(&sr, &sr, &u);
+					dn_subtract(&si, &si, &v);
+				}
+			if (dn_eq0(&sr) && dn_eq0(&si)) {
+				done[i] = 1;
+				continue;
+			}
+			poly_recip(&tr, &ti, &sr, &si);
+			dn_subtract(zr + i, zr + i, &tr);
+			dn_subtract(zi + i, zi + i, &ti);
+			poly_norm(&u, &tr, &ti);
+			poly_norm(&v, zr + i, zi + i);
+			dn_multiply(&e, &v, &eps2);
+			if (dn_le(&u, &e))
+				done[i] = 1;
+			else
+				active = 1;
+		}
+		if (! active)
+			break;
+		busy();
+	}
+
+	for (i=0; i<m; i++) {
+		poly_norm(&v, zr + i, zi + i);
+		dn_multiply(&e, &v, &eps2);
+		dn_multiply(&u, zi + i, zi + i);
+		if (dn_le(&u, &e))
+			decNumberZero(zi + i);
+		dn_multiply(&u, zr + i, zr + i);
+		if (dn_le(&u, &e))
+			decNumberZero(zr + i);
+	}
+	for (i=1; i<deg; i++)
+		for (j=i; j>0; j--) {
+			if (dn_lt(zr + j - 1, zr + j))
+				break;
+			if (dn_eq(zr + j - 1, zr + j) && ! dn_lt(zi + j, zi + j - 1))
+				break;
+			decNumberCopy(&tr, zr + j);
+			decNumberCopy(&ti, zi + j);
+			decNumberCopy(zr + j, zr + j - 1);
+			decNumberCopy(zi + j, zi + j - 1);
+			decNumberCopy(zr + j - 1, &tr);
+			decNumberCopy(zi + j - 1, &ti);
+		}
+	for (i=0; i<deg; i++) {
+		setRegister(base + 2 * i, zr + i);
+		setRegister(base + 2 * i + 1, zi + i);
+	}
+	int_to_dn(&u, base * 100 + 2 * deg);
+	dn_mulpow10(r, &u, -2);
+	free(a);
+	return r;
+
+out:
+	free(a);
+	return NULL;
+}
@@ -0,0 +1,34 @@
+/* This file is part of 34S.
+ *
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __POLY_H__
+#define __POLY_H__
+
+#include "xeq.h"
+
+/* Largest number of coefficients the root finder accepts, the roots are
+ * returned as real and imaginary pairs so this keeps them within nn = 99.
+ */
+#define POLY_MAX	50
+
+extern decNumber *poly_eval(decNumber *r, const decNumber *x, const decNumber *blk);
+extern void cpx_poly_eval(decNumber *rx, decNumber *ry,
+			const decNumber *a, const decNumber *b,
+			const decNumber *c, const decNumber *d);
+extern void poly_deriv(enum nilop op);
+extern decNumber *poly_roots(decNumber *r, const decNumber *dest, const decNumber *blk);
+
+#endif
@@ -413,10 +413,18 @@ void recv_any( enum nilop op )
 			/*
 			 *  Summation registers received
 			 */
-			if ( length != sizeof( STAT_DATA ) ) {
+			if ( length == SIZE_STAT_DATA_V0 ) {
+				/*
+				 *  Old layout without the central moments
+				 */
+				if ( sigmaCopyV0( buffer ) ) {
+					goto nak;
+				}
+			}
+			else if ( length != sizeof( STAT_DATA ) ) {
 				  goto invalid;
 			}
-			if ( sigmaCopy( buffer ) ) {
+			else if ( sigmaCopy( buffer ) ) {
 				goto nak;
 			}
 			DispMsg = "\221 Regs";
@@ -485,6 +493,9 @@ void send_registers( enum nilop op )
 void send_sigma( enum nilop op )
 {
 	if ( !sigmaCheck() ) {
+#ifdef LAZY_SIGMA
+		sigma_flush();
+#endif
 		put_block( TAG_SIGMA, sizeof( STAT_DATA ), StatRegs );
 	}
 }
@@ -495,6 +506,9 @@ void send_sigma( enum nilop op )
  */
 void send_all( enum nilop op )
 {
+#ifdef LAZY_SIGMA
+	sigma_flush();
+#endif
 	put_block( TAG_ALLMEM, sizeof( PersistentRam ), &PersistentRam );
 }
 
@@ -0,0 +1,678 @@
+/* Generated from image.c by tools/mksprite.c, do not edit. */
+#include <os.h>
+#include "sprite.h"
+
+//13*6, 67 opaque pixels
+static const unsigned char gSprite_top_runs[18] = {
+0X01,0X01,0X0B,0X01,0X00,0X0D,0X01,0X00,0X0D,0X01,0X01,0X0B,0X01,0X01,0X0A,0X01,
+0X01,0X09,
+};
+static const uint16_t gSprite_top_cx[67] = {
+0X0042,0X00E6,0X00E6,0X00E6,0X00E6,0X00E6,0X00E6,0X00E6,
+0X00E6,0X00E6,0X0000,0X00A4,0X02F3,0X03FA,0X03FA,0X03FA,
+0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X022F,0X0042,
+0X01AB,0X03B8,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,
+0X03FA,0X03FA,0X03FA,0X0398,0X0083,0X01ED,0X03FA,0X03FA,
+0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X0335,0X0020,
+0X0128,0X0398,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,
+0X0335,0X0021,0X0062,0X0127,0X02B1,0X02B1,0X02B1,0X02B1,
+0X02B1,0X02B1,0X0063,
+};
+static const unsigned char gSprite_top_grey[67] = {
+0X0E,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0C,0X0F,0X0D,0X06,0X02,0X02,0X02,
+0X02,0X02,0X02,0X02,0X02,0X02,0X08,0X0E,0X0A,0X03,0X02,0X02,0X02,0X02,0X02,0X02,
+0X02,0X02,0X02,0X03,0X0E,0X09,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X05,0X0F,
+0X0B,0X03,0X02,0X02,0X02,0X02,0X02,0X02,0X05,0X0F,0X0E,0X0C,0X07,0X07,0X07,0X07,
+0X07,0X07,0X0E,
+};
+const SPRITE gSprite_top = { 13, 6, gSprite_top_runs, gSprite_top_cx, gSprite_top_grey };
+
+//5*12, 53 opaque pixels
+static const unsigned char gSprite_lt_runs[36] = {
+0X01,0X01,0X02,0X01,0X00,0X04,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,
+0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,
+0X04,0X01,0X01,0X03,
+};
+static const uint16_t gSprite_lt_cx[53] = {
+0X0083,0X00A4,0X0083,0X0314,0X0376,0X0062,0X01ED,0X03FA,
+0X03FA,0X02F3,0X0062,0X01AB,0X03FA,0X03FA,0X03FA,0X022E,
+0X01AB,0X03FA,0X03FA,0X03FA,0X01EC,0X01AB,0X03FA,0X03FA,
+0X03FA,0X01EC,0X01AB,0X03FA,0X03FA,0X03FA,0X01EC,0X01AB,
+0X03FA,0X03FA,0X03FA,0X01EC,0X01AB,0X03FA,0X03FA,0X03FA,
+0X022E,0X01ED,0X03FA,0X03FA,0X0356,0X0107,0X00E6,0X0377,
+0X03B9,0X0083,0X00E6,0X00E6,0X0062,
+};
+static const unsigned char gSprite_lt_grey[53] = {
+0X0E,0X0D,0X0E,0X05,0X04,0X0E,0X09,0X02,0X02,0X06,0X0E,0X0A,0X02,0X02,0X02,0X08,
+0X0A,0X02,0X02,0X02,0X09,0X0A,0X02,0X02,0X02,0X09,0X0A,0X02,0X02,0X02,0X09,0X0A,
+0X02,0X02,0X02,0X09,0X0A,0X02,0X02,0X02,0X08,0X09,0X02,0X02,0X04,0X0C,0X0C,0X04,
+0X03,0X0E,0X0C,0X0C,0X0E,
+};
+const SPRITE gSprite_lt = { 5, 12, gSprite_lt_runs, gSprite_lt_cx, gSprite_lt_grey };
+
+//12*5, 56 opaque pixels
+static const unsigned char gSprite_middle_runs[15] = {
+0X01,0X01,0X0A,0X01,0X00,0X0C,0X01,0X00,0X0C,0X01,0X00,0X0C,0X01,0X01,0X0A,
+};
+static const uint16_t gSprite_middle_cx[56] = {
+0X0062,0X01EC,0X01EC,0X01EC,0X01EC,0X01EC,0X01EC,0X01EC,
+0X01EC,0X0041,0X0083,0X0335,0X03FA,0X03FA,0X03FA,0X03FA,
+0X03FA,0X03FA,0X03FA,0X03FA,0X02D2,0X0084,0X0270,0X03FA,
+0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,
+0X03FA,0X018A,0X0083,0X0335,0X03FA,0X03FA,0X03FA,0X03FA,
+0X03FA,0X03FA,0X03FA,0X03FA,0X02B2,0X0021,0X0042,0X01CB,
+0X01CB,0X01CB,0X01CB,0X01CB,0X01CB,0X01CB,0X01CB,0X0000,
+};
+static const unsigned char gSprite_middle_grey[56] = {
+0X0E,0X09,0X09,0X09,0X09,0X09,0X09,0X09,0X09,0X0F,0X0E,0X05,0X02,0X02,0X02,0X02,
+0X02,0X02,0X02,0X02,0X06,0X0D,0X07,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,
+0X02,0X0A,0X0E,0X05,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X06,0X0F,0X0E,0X0A,
+0X0A,0X0A,0X0A,0X0A,0X0A,0X0A,0X0A,0X0F,
+};
+const SPRITE gSprite_middle = { 12, 5, gSprite_middle_runs, gSprite_middle_cx, gSprite_middle_grey };
+
+//5*13, 57 opaque pixels
+static const unsigned char gSprite_rt_runs[39] = {
+0X01,0X01,0X03,0X01,0X00,0X04,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,
+0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,
+0X05,0X01,0X01,0X03,0X01,0X02,0X02,
+};
+static const uint16_t gSprite_rt_cx[57] = {
+0X0020,0X00C5,0X0062,0X0021,0X00A4,0X03FA,0X0106,0X00C5,
+0X0398,0X03FA,0X01EC,0X0042,0X0335,0X03FA,0X03FA,0X03FA,
+0X0106,0X02D2,0X03FA,0X03FA,0X03FA,0X00E5,0X02D2,0X03FA,
+0X03FA,0X03FA,0X00E5,0X02D2,0X03FA,0X03FA,0X03FA,0X00E5,
+0X02D2,0X03FA,0X03FA,0X03FA,0X00E5,0X02D2,0X03FA,0X03FA,
+0X03FA,0X00E5,0X0335,0X03FA,0X03FA,0X03FA,0X00E6,0X0169,
+0X03D9,0X03FA,0X0290,0X0063,0X0148,0X03FA,0X00C5,0X018A,
+0X00A4,
+};
+static const unsigned char gSprite_rt_grey[57] = {
+0X0F,0X0D,0X0E,0X0F,0X0D,0X02,0X0C,0X0D,0X03,0X02,0X09,0X0E,0X05,0X02,0X02,0X02,
+0X0C,0X06,0X02,0X02,0X02,0X0D,0X06,0X02,0X02,0X02,0X0D,0X06,0X02,0X02,0X02,0X0D,
+0X06,0X02,0X02,0X02,0X0D,0X06,0X02,0X02,0X02,0X0D,0X05,0X02,0X02,0X02,0X0C,0X0B,
+0X03,0X02,0X07,0X0E,0X0B,0X02,0X0D,0X0A,0X0D,
+};
+const SPRITE gSprite_rt = { 5, 13, gSprite_rt_runs, gSprite_rt_cx, gSprite_rt_grey };
+
+//5*13, 59 opaque pixels
+static const unsigned char gSprite_lb_runs[39] = {
+0X01,0X01,0X03,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,
+0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,
+0X05,0X01,0X00,0X04,0X01,0X01,0X02,
+};
+static const uint16_t gSprite_lb_cx[59] = {
+0X00E6,0X0148,0X0083,0X00E6,0X0377,0X03D9,0X00A4,0X0042,
+0X01CC,0X03FA,0X03FA,0X0377,0X00E5,0X018A,0X03FA,0X03FA,
+0X03FA,0X024F,0X018A,0X03FA,0X03FA,0X03FA,0X020D,0X018A,
+0X03FA,0X03FA,0X03FA,0X020D,0X018A,0X03FA,0X03FA,0X03FA,
+0X020D,0X018A,0X03FA,0X03FA,0X03FA,0X020D,0X018A,0X03FA,
+0X03FA,0X03FA,0X020D,0X018A,0X03FA,0X03FA,0X03FA,0X024F,
+0X01CC,0X03FA,0X03FA,0X02F3,0X0042,0X0063,0X02F4,0X0377,
+0X0021,0X0063,0X0062,
+};
+static const unsigned char gSprite_lb_grey[59] = {
+0X0C,0X0B,0X0E,0X0C,0X04,0X03,0X0D,0X0E,0X09,0X02,0X02,0X04,0X0D,0X0A,0X02,0X02,
+0X02,0X08,0X0A,0X02,0X02,0X02,0X09,0X0A,0X02,0X02,0X02,0X09,0X0A,0X02,0X02,0X02,
+0X09,0X0A,0X02,0X02,0X02,0X09,0X0A,0X02,0X02,0X02,0X09,0X0A,0X02,0X02,0X02,0X08,
+0X09,0X02,0X02,0X06,0X0E,0X0E,0X05,0X04,0X0F,0X0E,0X0E,
+};
+const SPRITE gSprite_lb = { 5, 13, gSprite_lb_runs, gSprite_lb_cx, gSprite_lb_grey };
+
+//12*5, 55 opaque pixels
+static const unsigned char gSprite_bottom_runs[15] = {
+0X01,0X01,0X09,0X01,0X00,0X0C,0X01,0X00,0X0C,0X01,0X00,0X0C,0X01,0X01,0X0A,
+};
+static const uint16_t gSprite_bottom_cx[55] = {
+0X0021,0X00E6,0X02D3,0X02D3,0X02D3,0X02D3,0X02D3,0X02D3,
+0X00A4,0X0062,0X00E6,0X0398,0X03FA,0X03FA,0X03FA,0X03FA,
+0X03FA,0X03FA,0X0376,0X00A4,0X0083,0X0148,0X03D9,0X03FA,
+0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03B8,
+0X00E5,0X0083,0X02B2,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,
+0X03FA,0X03FA,0X03FA,0X024F,0X0062,0X0041,0X00E5,0X00E5,
+0X00E5,0X00E5,0X00E5,0X00E5,0X00E5,0X00E5,0X0020,
+};
+static const unsigned char gSprite_bottom_grey[55] = {
+0X0F,0X0C,0X06,0X06,0X06,0X06,0X06,0X06,0X0D,0X0E,0X0C,0X03,0X02,0X02,0X02,0X02,
+0X02,0X02,0X04,0X0D,0X0E,0X0B,0X03,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X03,
+0X0D,0X0E,0X06,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X08,0X0E,0X0F,0X0D,0X0D,
+0X0D,0X0D,0X0D,0X0D,0X0D,0X0D,0X0F,
+};
+const SPRITE gSprite_bottom = { 12, 5, gSprite_bottom_runs, gSprite_bottom_cx, gSprite_bottom_grey };
+
+//5*14, 62 opaque pixels
+static const unsigned char gSprite_rb_runs[42] = {
+0X01,0X01,0X03,0X01,0X01,0X04,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,
+0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,
+0X05,0X01,0X00,0X04,0X01,0X00,0X04,0X01,0X01,0X02,
+};
+static const uint16_t gSprite_rb_cx[62] = {
+0X0021,0X01AB,0X0042,0X0128,0X03FA,0X02F3,0X0083,0X0149,
+0X03D9,0X03FA,0X03FA,0X0107,0X0314,0X03FA,0X03FA,0X03FA,
+0X00E6,0X02B2,0X03FA,0X03FA,0X03FA,0X00E6,0X02B2,0X03FA,
+0X03FA,0X03FA,0X00E6,0X02B2,0X03FA,0X03FA,0X03FA,0X00E6,
+0X02B2,0X03FA,0X03FA,0X03FA,0X00E6,0X02B2,0X03FA,0X03FA,
+0X03FA,0X00E6,0X02B2,0X03FA,0X03FA,0X03FA,0X00E6,0X02B2,
+0X03FA,0X03FA,0X03FA,0X0107,0X0314,0X03FA,0X03FA,0X01ED,
+0X0083,0X03D9,0X024F,0X0000,0X00C5,0X0021,
+};
+static const unsigned char gSprite_rb_grey[62] = {
+0X0F,0X0A,0X0E,0X0B,0X02,0X06,0X0E,0X0B,0X03,0X02,0X02,0X0C,0X05,0X02,0X02,0X02,
+0X0C,0X06,0X02,0X02,0X02,0X0C,0X06,0X02,0X02,0X02,0X0C,0X06,0X02,0X02,0X02,0X0C,
+0X06,0X02,0X02,0X02,0X0C,0X06,0X02,0X02,0X02,0X0C,0X06,0X02,0X02,0X02,0X0C,0X06,
+0X02,0X02,0X02,0X0C,0X05,0X02,0X02,0X09,0X0E,0X03,0X08,0X0F,0X0D,0X0F,
+};
+const SPRITE gSprite_rb = { 5, 14, gSprite_rb_runs, gSprite_rb_cx, gSprite_rb_grey };
+
+//5*4, 19 opaque pixels
+static const unsigned char gSprite_dot_runs[12] = {
+0X01,0X00,0X04,0X01,0X00,0X05,0X01,0X00,0X05,0X01,0X00,0X05,
+};
+static const uint16_t gSprite_dot_cx[19] = {
+0X0042,0X0127,0X02D3,0X0106,0X0128,0X0398,0X03FA,0X0397,
+0X0148,0X022F,0X03FA,0X03FA,0X03FA,0X020D,0X0063,0X02B1,
+0X03FA,0X0270,0X0062,
+};
+static const unsigned char gSprite_dot_grey[19] = {
+0X0E,0X0C,0X06,0X0C,0X0B,0X03,0X02,0X04,0X0B,0X08,0X02,0X02,0X02,0X09,0X0E,0X07,
+0X02,0X07,0X0E,
+};
+const SPRITE gSprite_dot = { 5, 4, gSprite_dot_runs, gSprite_dot_cx, gSprite_dot_grey };
+
+//6*7, 34 opaque pixels
+static const unsigned char gSprite_comma_runs[21] = {
+0X01,0X03,0X03,0X01,0X01,0X05,0X01,0X01,0X05,0X01,0X01,0X05,0X01,0X00,0X06,0X01,
+0X00,0X05,0X01,0X00,0X05,
+};
+static const uint16_t gSprite_comma_cx[34] = {
+0X0083,0X0000,0X0000,0X018A,0X0314,0X02F3,0X0127,0X0000,
+0X020D,0X03FA,0X03FA,0X03B8,0X0169,0X01CB,0X03FA,0X03FA,
+0X03FA,0X01EC,0X018A,0X03B8,0X03FA,0X03FA,0X022F,0X0041,
+0X01ED,0X03FA,0X024F,0X0083,0X0021,0X01CB,0X03D9,0X01ED,
+0X0021,0X0000,
+};
+static const unsigned char gSprite_comma_grey[34] = {
+0X0E,0X0F,0X0F,0X0A,0X05,0X06,0X0C,0X0F,0X09,0X02,0X02,0X03,0X0B,0X0A,0X02,0X02,
+0X02,0X09,0X0A,0X03,0X02,0X02,0X08,0X0F,0X09,0X02,0X08,0X0E,0X0F,0X0A,0X03,0X09,
+0X0F,0X0F,
+};
+const SPRITE gSprite_comma = { 6, 7, gSprite_comma_runs, gSprite_comma_cx, gSprite_comma_grey };
+
+//8*4, 30 opaque pixels
+static const unsigned char gSprite_stop_runs[12] = {
+0X01,0X00,0X08,0X01,0X00,0X08,0X01,0X00,0X08,0X01,0X01,0X06,
+};
+static const uint16_t gSprite_stop_cx[30] = {
+0X0000,0X00E6,0X0149,0X0149,0X0149,0X0149,0X00E6,0X0020,
+0X0041,0X020D,0X03FA,0X03FA,0X03FA,0X03FA,0X0291,0X0062,
+0X0127,0X03D9,0X03FA,0X03FA,0X03FA,0X03FA,0X03D9,0X018A,
+0X0107,0X0335,0X0335,0X0335,0X0335,0X0169,
+};
+static const unsigned char gSprite_stop_grey[30] = {
+0X0F,0X0C,0X0B,0X0B,0X0B,0X0B,0X0C,0X0F,0X0F,0X09,0X02,0X02,0X02,0X02,0X07,0X0E,
+0X0C,0X03,0X02,0X02,0X02,0X02,0X03,0X0A,0X0C,0X05,0X05,0X05,0X05,0X0B,
+};
+const SPRITE gSprite_stop = { 8, 4, gSprite_stop_runs, gSprite_stop_cx, gSprite_stop_grey };
+
+//4*8, 30 opaque pixels
+static const unsigned char gSprite_slt_runs[24] = {
+0X01,0X00,0X03,0X01,0X00,0X04,0X01,0X00,0X04,0X01,0X00,0X04,0X01,0X00,0X04,0X01,
+0X00,0X04,0X01,0X00,0X04,0X01,0X00,0X03,
+};
+static const uint16_t gSprite_slt_cx[30] = {
+0X0021,0X022E,0X0397,0X0148,0X03FA,0X03FA,0X02D2,0X0127,
+0X03FA,0X03FA,0X0291,0X0127,0X03FA,0X03FA,0X0291,0X0127,
+0X03FA,0X03FA,0X0291,0X0148,0X03FA,0X03FA,0X02D2,0X00C5,
+0X0377,0X03FA,0X01AB,0X0000,0X00A4,0X01CC,
+};
+static const unsigned char gSprite_slt_grey[30] = {
+0X0F,0X08,0X04,0X0B,0X02,0X02,0X06,0X0C,0X02,0X02,0X07,0X0C,0X02,0X02,0X07,0X0C,
+0X02,0X02,0X07,0X0B,0X02,0X02,0X06,0X0D,0X04,0X02,0X0A,0X0F,0X0D,0X09,
+};
+const SPRITE gSprite_slt = { 4, 8, gSprite_slt_runs, gSprite_slt_cx, gSprite_slt_grey };
+
+//7*4, 25 opaque pixels
+static const unsigned char gSprite_smiddle_runs[12] = {
+0X01,0X01,0X05,0X01,0X00,0X07,0X01,0X00,0X07,0X01,0X01,0X06,
+};
+static const uint16_t gSprite_smiddle_cx[25] = {
+0X0021,0X0127,0X0127,0X0127,0X0062,0X0021,0X02B1,0X03FA,
+0X03FA,0X03FA,0X0314,0X0083,0X00E6,0X03B8,0X03FA,0X03FA,
+0X03FA,0X03D9,0X0169,0X00A4,0X02B1,0X02B1,0X02B1,0X0127,
+0X0062,
+};
+static const unsigned char gSprite_smiddle_grey[25] = {
+0X0F,0X0C,0X0C,0X0C,0X0E,0X0F,0X07,0X02,0X02,0X02,0X05,0X0E,0X0C,0X03,0X02,0X02,
+0X02,0X03,0X0B,0X0D,0X07,0X07,0X07,0X0C,0X0E,
+};
+const SPRITE gSprite_smiddle = { 7, 4, gSprite_smiddle_runs, gSprite_smiddle_cx, gSprite_smiddle_grey };
+
+//4*7, 28 opaque pixels
+static const unsigned char gSprite_srt_runs[21] = {
+0X01,0X00,0X04,0X01,0X00,0X04,0X01,0X00,0X04,0X01,0X00,0X04,0X01,0X00,0X04,0X01,
+0X00,0X04,0X01,0X00,0X04,
+};
+static const uint16_t gSprite_srt_cx[28] = {
+0X0021,0X0314,0X02F3,0X0042,0X020E,0X03FA,0X03FA,0X01ED,
+0X01EC,0X03FA,0X03FA,0X01CB,0X01EC,0X03FA,0X03FA,0X01CB,
+0X020D,0X03FA,0X03FA,0X01EC,0X0128,0X03D9,0X03B9,0X0148,
+0X0083,0X0169,0X0148,0X0000,
+};
+static const unsigned char gSprite_srt_grey[28] = {
+0X0F,0X05,0X06,0X0E,0X08,0X02,0X02,0X09,0X09,0X02,0X02,0X0A,0X09,0X02,0X02,0X0A,
+0X09,0X02,0X02,0X09,0X0B,0X03,0X03,0X0B,0X0E,0X0B,0X0B,0X0F,
+};
+const SPRITE gSprite_srt = { 4, 7, gSprite_srt_runs, gSprite_srt_cx, gSprite_srt_grey };
+
+//4*8, 31 opaque pixels
+static const unsigned char gSprite_slb_runs[24] = {
+0X01,0X00,0X03,0X01,0X00,0X04,0X01,0X00,0X04,0X01,0X00,0X04,0X01,0X00,0X04,0X01,
+0X00,0X04,0X01,0X00,0X04,0X01,0X00,0X04,
+};
+static const uint16_t gSprite_slb_cx[31] = {
+0X0000,0X0000,0X0083,0X0062,0X02B1,0X03D9,0X00A4,0X0149,
+0X03FA,0X03FA,0X02F3,0X0127,0X03FA,0X03FA,0X0291,0X0127,
+0X03FA,0X03FA,0X0291,0X0127,0X03FA,0X03FA,0X0291,0X0148,
+0X03FA,0X03FA,0X024F,0X00A4,0X02F3,0X03FA,0X0148,
+};
+static const unsigned char gSprite_slb_grey[31] = {
+0X0F,0X0F,0X0E,0X0E,0X07,0X03,0X0D,0X0B,0X02,0X02,0X06,0X0C,0X02,0X02,0X07,0X0C,
+0X02,0X02,0X07,0X0C,0X02,0X02,0X07,0X0B,0X02,0X02,0X08,0X0D,0X06,0X02,0X0B,
+};
+const SPRITE gSprite_slb = { 4, 8, gSprite_slb_runs, gSprite_slb_cx, gSprite_slb_grey };
+
+//7*4, 27 opaque pixels
+static const unsigned char gSprite_sbottom_runs[12] = {
+0X01,0X01,0X06,0X01,0X00,0X07,0X01,0X00,0X07,0X01,0X00,0X07,
+};
+static const uint16_t gSprite_sbottom_cx[27] = {
+0X01AB,0X01AB,0X01AB,0X01AB,0X00A4,0X00C5,0X02F3,0X03FA,
+0X03FA,0X03FA,0X03FA,0X0377,0X00E6,0X02F3,0X03FA,0X03FA,
+0X03FA,0X03FA,0X03B8,0X0149,0X0042,0X020D,0X020D,0X020D,
+0X020D,0X00C5,0X0000,
+};
+static const unsigned char gSprite_sbottom_grey[27] = {
+0X0A,0X0A,0X0A,0X0A,0X0D,0X0D,0X06,0X02,0X02,0X02,0X02,0X04,0X0C,0X06,0X02,0X02,
+0X02,0X02,0X03,0X0B,0X0E,0X09,0X09,0X09,0X09,0X0D,0X0F,
+};
+const SPRITE gSprite_sbottom = { 7, 4, gSprite_sbottom_runs, gSprite_sbottom_cx, gSprite_sbottom_grey };
+
+//4*8, 30 opaque pixels
+static const unsigned char gSprite_srb_runs[24] = {
+0X01,0X01,0X03,0X01,0X00,0X04,0X01,0X00,0X04,0X01,0X00,0X04,0X01,0X00,0X04,0X01,
+0X00,0X04,0X01,0X00,0X04,0X01,0X01,0X03,
+};
+static const uint16_t gSprite_srb_cx[30] = {
+0X0376,0X0355,0X0084,0X022E,0X03FA,0X03FA,0X020D,0X01EC,
+0X03FA,0X03FA,0X01CB,0X01EC,0X03FA,0X03FA,0X01CB,0X01EC,
+0X03FA,0X03FA,0X01CB,0X022E,0X03FA,0X03FA,0X01ED,0X00C5,
+0X03B8,0X0398,0X0106,0X0128,0X0107,0X0000,
+};
+static const unsigned char gSprite_srb_grey[30] = {
+0X04,0X05,0X0D,0X08,0X02,0X02,0X09,0X09,0X02,0X02,0X0A,0X09,0X02,0X02,0X0A,0X09,
+0X02,0X02,0X0A,0X08,0X02,0X02,0X09,0X0D,0X03,0X03,0X0C,0X0B,0X0C,0X0F,
+};
+const SPRITE gSprite_srb = { 4, 8, gSprite_srb_runs, gSprite_srb_cx, gSprite_srb_grey };
+
+//14*8, 112 opaque pixels
+static const unsigned char gSprite_lequal_runs[24] = {
+0X01,0X00,0X0E,0X01,0X00,0X0E,0X01,0X00,0X0E,0X01,0X00,0X0E,0X01,0X00,0X0E,0X01,
+0X00,0X0E,0X01,0X00,0X0E,0X01,0X00,0X0E,
+};
+static const uint16_t gSprite_lequal_cx[112] = {
+0X02F3,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,
+0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X02F3,0X03FA,
+0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,
+0X03FA,0X03FA,0X03FA,0X03FA,0X0000,0X0000,0X0000,0X0000,
+0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,
+0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,
+0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,
+0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,
+0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,
+0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,0X0000,
+0X0000,0X0000,0X0000,0X0000,0X02F3,0X03FA,0X03FA,0X03FA,
+0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,
+0X03FA,0X03FA,0X02F3,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,
+0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,0X03FA,
+};
+static const unsigned char gSprite_lequal_grey[112] = {
+0X06,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X06,0X02,
+0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X0F,0X0F,0X0F,0X0F,
+0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,
+0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,
+0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,
+0X0F,0X0F,0X0F,0X0F,0X06,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,
+0X02,0X02,0X06,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,0X02,
+};
+const SPRITE gSprite_lequal = { 14, 8, gSprite_lequal_runs, gSprite_lequal_cx, gSprite_lequal_grey };
+
+//6*3, 18 opaque pixels
+static const unsigned char gSprite_sequal_runs[9] = {
+0X01,0X00,0X06,0X01,0X00,0X06,0X01,0X00,0X06,
+};
+static const uint16_t gSprite_sequal_cx[18] = {
+0X01ED,0X01ED,0X01ED,0X01ED,0X01ED,0X016A,0X0000,0X0000,
+0X0000,0X0000,0X0000,0X0000,0X02F3,0X02F3,0X02F3,0X02F3,
+0X02F3,0X022E,
+};
+static const unsigned char gSprite_sequal_grey[18] = {
+0X09,0X09,0X09,0X09,0X09,0X0A,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X06,0X06,0X06,0X06,
+0X06,0X08,
+};
+const SPRITE gSprite_sequal = { 6, 3, gSprite_sequal_runs, gSprite_sequal_cx, gSprite_sequal_grey };
+
+//8*8, 64 opaque pixels
+static const unsigned char gSprite_arrow_runs[24] = {
+0X01,0X00,0X08,0X01,0X00,0X08,0X01,0X00,0X08,0X01,0X00,0X08,0X01,0X00,0X08,0X01,
+0X00,0X08,0X01,0X00,0X08,0X01,0X00,0X08,
+};
+static const uint16_t gSprite_arrow_cx[64] = {
+0X0000,0X0000,0X03B9,0X03FA,0X03FA,0X03B9,0X0000,0X0000,
+0X0000,0X0000,0X03B9,0X03FA,0X03FA,0X03B9,0X0000,0X0000,
+0X0000,0X0000,0X03B9,0X03FA,0X03FA,0X03B9,0X0000,0X0000,
+0X0000,0X0000,0X03B9,0X03FA,0X03FA,0X03B9,0X0000,0X0000,
+0X01CC,0X0335,0X03FA,0X03FA,0X03FA,0X03FA,0X0335,0X01CC,
+0X0000,0X0270,0X03FA,0X03FA,0X03FA,0X03FA,0X0270,0X0000,
+0X0000,0X0000,0X024F,0X03FA,0X03FA,0X024F,0X0000,0X0000,
+0X0000,0X0000,0X0000,0X020E,0X020E,0X0000,0X0000,0X0000,
+};
+static const unsigned char gSprite_arrow_grey[64] = {
+0X0F,0X0F,0X03,0X02,0X02,0X03,0X0F,0X0F,0X0F,0X0F,0X03,0X02,0X02,0X03,0X0F,0X0F,
+0X0F,0X0F,0X03,0X02,0X02,0X03,0X0F,0X0F,0X0F,0X0F,0X03,0X02,0X02,0X03,0X0F,0X0F,
+0X09,0X05,0X02,0X02,0X02,0X02,0X05,0X09,0X0F,0X07,0X02,0X02,0X02,0X02,0X07,0X0F,
+0X0F,0X0F,0X08,0X02,0X02,0X08,0X0F,0X0F,0X0F,0X0F,0X0F,0X08,0X08,0X0F,0X0F,0X0F,
+};
+const SPRITE gSprite_arrow = { 8, 8, gSprite_arrow_runs, gSprite_arrow_cx, gSprite_arrow_grey };
+
+//28*8, 224 opaque pixels
+static const unsigned char gSprite_input_runs[24] = {
+0X01,0X00,0X1C,0X01,0X00,0X1C,0X01,0X00,0X1C,0X01,0X00,0X1C,0X01,0X00,0X1C,0X01,
+0X00,0X1C,0X01,0X00,0X1C,0X01,0X00,0X1C,
+};
+static const uint16_t gSprite_input_cx[224] = {
+0X016A,0X016A,0X0000,0X022E,0X01AB,0X0000,0X0000,0X0000,
+0X022E,0X0000,0X022E,0X02F3,0X02F3,0X02F3,0X0148,0X0000,
+0X00C5,0X016A,0X0000,0X0000,0X0000,0X022E,0X00C5,0X02F3,
+0X02F3,0X02F3,0X02F3,0X02F3,0X01ED,0X01ED,0X0000,0X02F3,
+0X0377,0X0083,0X0000,0X0000,0X02F3,0X0000,0X02F3,0X0106,
+0X0000,0X0083,0X0377,0X0083,0X0106,0X01ED,0X0000,0X0000,
+0X0000,0X02F3,0X0000,0X0000,0X0000,0X03FA,0X0000,0X0000,
+0X01ED,0X01ED,0X0000,0X02F3,0X0106,0X02B2,0X0000,0X0000,
+0X02F3,0X0000,0X02F3,0X0106,0X0000,0X0000,0X02F3,0X0106,
+0X0106,0X01ED,0X0000,0X0000,0X0000,0X02F3,0X0000,0X0000,
+0X0000,0X03FA,0X0000,0X0000,0X01ED,0X01ED,0X0000,0X02F3,
+0X0000,0X02B2,0X0106,0X0000,0X02F3,0X0000,0X02F3,0X0106,
+0X0000,0X0106,0X0377,0X0083,0X0106,0X01ED,0X0000,0X0000,
+0X0000,0X02F3,0X0000,0X0000,0X0000,0X03FA,0X0000,0X0000,
+0X01ED,0X01ED,0X0000,0X02F3,0X0000,0X0083,0X0335,0X0000,
+0X02F3,0X0000,0X02F3,0X0335,0X02F3,0X0270,0X00C5,0X0000,
+0X0106,0X01ED,0X0000,0X0000,0X0000,0X02F3,0X0000,0X0000,
+0X0000,0X03FA,0X0000,0X0000,0X01ED,0X01ED,0X0000,0X02F3,
+0X0000,0X0000,0X01ED,0X01AB,0X02F3,0X0000,0X02F3,0X0106,
+0X0000,0X0000,0X0000,0X0000,0X0106,0X0270,0X0000,0X0000,
+0X0000,0X02F3,0X0000,0X0000,0X0000,0X03FA,0X0000,0X0000,
+0X01ED,0X01ED,0X0000,0X02F3,0X0000,0X0000,0X0041,0X0335,
+0X02F3,0X0000,0X02F3,0X0106,0X0000,0X0000,0X0000,0X0000,
+0X0083,0X0377,0X0083,0X0000,0X016A,0X0270,0X0000,0X0000,
+0X0000,0X03FA,0X0000,0X0000,0X016A,0X016A,0X0000,0X022E,
+0X0000,0X0000,0X0000,0X0148,0X022E,0X0000,0X022E,0X00C5,
+0X0000,0X0000,0X0000,0X0000,0X0000,0X0148,0X02F3,0X02F3,
+0X0270,0X0041,0X0000,0X0000,0X0000,0X02F3,0X0000,0X0000,
+};
+static const unsigned char gSprite_input_grey[224] = {
+0X0A,0X0A,0X0F,0X08,0X0A,0X0F,0X0F,0X0F,0X08,0X0F,0X08,0X06,0X06,0X06,0X0B,0X0F,
+0X0D,0X0A,0X0F,0X0F,0X0F,0X08,0X0D,0X06,0X06,0X06,0X06,0X06,0X09,0X09,0X0F,0X06,
+0X04,0X0E,0X0F,0X0F,0X06,0X0F,0X06,0X0C,0X0F,0X0E,0X04,0X0E,0X0C,0X09,0X0F,0X0F,
+0X0F,0X06,0X0F,0X0F,0X0F,0X02,0X0F,0X0F,0X09,0X09,0X0F,0X06,0X0C,0X06,0X0F,0X0F,
+0X06,0X0F,0X06,0X0C,0X0F,0X0F,0X06,0X0C,0X0C,0X09,0X0F,0X0F,0X0F,0X06,0X0F,0X0F,
+0X0F,0X02,0X0F,0X0F,0X09,0X09,0X0F,0X06,0X0F,0X06,0X0C,0X0F,0X06,0X0F,0X06,0X0C,
+0X0F,0X0C,0X04,0X0E,0X0C,0X09,0X0F,0X0F,0X0F,0X06,0X0F,0X0F,0X0F,0X02,0X0F,0X0F,
+0X09,0X09,0X0F,0X06,0X0F,0X0E,0X05,0X0F,0X06,0X0F,0X06,0X05,0X06,0X07,0X0D,0X0F,
+0X0C,0X09,0X0F,0X0F,0X0F,0X06,0X0F,0X0F,0X0F,0X02,0X0F,0X0F,0X09,0X09,0X0F,0X06,
+0X0F,0X0F,0X09,0X0A,0X06,0X0F,0X06,0X0C,0X0F,0X0F,0X0F,0X0F,0X0C,0X07,0X0F,0X0F,
+0X0F,0X06,0X0F,0X0F,0X0F,0X02,0X0F,0X0F,0X09,0X09,0X0F,0X06,0X0F,0X0F,0X0F,0X05,
+0X06,0X0F,0X06,0X0C,0X0F,0X0F,0X0F,0X0F,0X0E,0X04,0X0E,0X0F,0X0A,0X07,0X0F,0X0F,
+0X0F,0X02,0X0F,0X0F,0X0A,0X0A,0X0F,0X08,0X0F,0X0F,0X0F,0X0B,0X08,0X0F,0X08,0X0D,
+0X0F,0X0F,0X0F,0X0F,0X0F,0X0B,0X06,0X06,0X07,0X0F,0X0F,0X0F,0X0F,0X06,0X0F,0X0F,
+};
+const SPRITE gSprite_input = { 28, 8, gSprite_input_runs, gSprite_input_cx, gSprite_input_grey };
+
+//19*8, 152 opaque pixels
+static const unsigned char gSprite_BEG_runs[24] = {
+0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,
+0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,
+};
+static const uint16_t gSprite_BEG_cx[152] = {
+0X02F3,0X02F3,0X02F3,0X02F3,0X0148,0X0000,0X00C5,0X02F3,
+0X02F3,0X02F3,0X02F3,0X016A,0X0000,0X0041,0X0270,0X03B8,
+0X0335,0X016A,0X0000,0X02F3,0X0000,0X0000,0X0083,0X03B8,
+0X0000,0X0106,0X02F3,0X0000,0X0000,0X0000,0X0000,0X0000,
+0X02F3,0X016A,0X0000,0X0041,0X0335,0X0106,0X02F3,0X0000,
+0X0000,0X0000,0X0377,0X0000,0X0106,0X02F3,0X0000,0X0000,
+0X0000,0X0000,0X00C5,0X0335,0X0000,0X0000,0X0000,0X0106,
+0X0083,0X0377,0X01ED,0X01ED,0X0335,0X016A,0X0000,0X0106,
+0X0377,0X01ED,0X01ED,0X016A,0X0000,0X01ED,0X01ED,0X0000,
+0X0000,0X0000,0X0000,0X0000,0X0335,0X0106,0X0106,0X0148,
+0X02F3,0X0041,0X0106,0X0335,0X0106,0X0106,0X00C5,0X0000,
+0X01ED,0X01ED,0X0000,0X00C5,0X02F3,0X0335,0X01ED,0X02F3,
+0X0000,0X0000,0X0000,0X02F3,0X0106,0X0106,0X02F3,0X0000,
+0X0000,0X0000,0X0000,0X0106,0X0335,0X0000,0X0000,0X0000,
+0X01AB,0X01ED,0X02F3,0X0000,0X0000,0X00C5,0X0377,0X0083,
+0X0106,0X02F3,0X0000,0X0000,0X0000,0X0000,0X0000,0X0335,
+0X016A,0X0000,0X0041,0X0335,0X01ED,0X02F3,0X02F3,0X02F3,
+0X02B2,0X0148,0X0000,0X00C5,0X02F3,0X02F3,0X02F3,0X02F3,
+0X016A,0X0000,0X0041,0X0270,0X02F3,0X02B2,0X0106,0X016A,
+};
+static const unsigned char gSprite_BEG_grey[152] = {
+0X06,0X06,0X06,0X06,0X0B,0X0F,0X0D,0X06,0X06,0X06,0X06,0X0A,0X0F,0X0F,0X07,0X03,
+0X05,0X0A,0X0F,0X06,0X0F,0X0F,0X0E,0X03,0X0F,0X0C,0X06,0X0F,0X0F,0X0F,0X0F,0X0F,
+0X06,0X0A,0X0F,0X0F,0X05,0X0C,0X06,0X0F,0X0F,0X0F,0X04,0X0F,0X0C,0X06,0X0F,0X0F,
+0X0F,0X0F,0X0D,0X05,0X0F,0X0F,0X0F,0X0C,0X0E,0X04,0X09,0X09,0X05,0X0A,0X0F,0X0C,
+0X04,0X09,0X09,0X0A,0X0F,0X09,0X09,0X0F,0X0F,0X0F,0X0F,0X0F,0X05,0X0C,0X0C,0X0B,
+0X06,0X0F,0X0C,0X05,0X0C,0X0C,0X0D,0X0F,0X09,0X09,0X0F,0X0D,0X06,0X05,0X09,0X06,
+0X0F,0X0F,0X0F,0X06,0X0C,0X0C,0X06,0X0F,0X0F,0X0F,0X0F,0X0C,0X05,0X0F,0X0F,0X0F,
+0X0A,0X09,0X06,0X0F,0X0F,0X0D,0X04,0X0E,0X0C,0X06,0X0F,0X0F,0X0F,0X0F,0X0F,0X05,
+0X0A,0X0F,0X0F,0X05,0X09,0X06,0X06,0X06,0X06,0X0B,0X0F,0X0D,0X06,0X06,0X06,0X06,
+0X0A,0X0F,0X0F,0X07,0X06,0X06,0X0C,0X0A,
+};
+const SPRITE gSprite_BEG = { 19, 8, gSprite_BEG_runs, gSprite_BEG_cx, gSprite_BEG_grey };
+
+//19*8, 152 opaque pixels
+static const unsigned char gSprite_STO_runs[24] = {
+0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,
+0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,
+};
+static const uint16_t gSprite_STO_cx[152] = {
+0X0000,0X01ED,0X0335,0X0335,0X0270,0X0041,0X016A,0X02F3,
+0X02F3,0X02F3,0X02F3,0X022E,0X0000,0X0083,0X02B2,0X03FA,
+0X02F3,0X00C5,0X0000,0X0148,0X02B2,0X0000,0X0000,0X016A,
+0X0270,0X0000,0X0000,0X0106,0X02F3,0X0000,0X0000,0X0000,
+0X0335,0X0106,0X0000,0X00C5,0X0377,0X0083,0X016A,0X02B2,
+0X0000,0X0000,0X0000,0X0041,0X0000,0X0000,0X0106,0X02F3,
+0X0000,0X0000,0X0148,0X02B2,0X0000,0X0000,0X0000,0X022E,
+0X01ED,0X0041,0X02F3,0X0377,0X0270,0X016A,0X0000,0X0000,
+0X0000,0X0106,0X02F3,0X0000,0X0000,0X01ED,0X01ED,0X0000,
+0X0000,0X0000,0X0106,0X02F3,0X0000,0X0000,0X0083,0X016A,
+0X02F3,0X02F3,0X0000,0X0000,0X0106,0X02F3,0X0000,0X0000,
+0X01ED,0X01ED,0X0000,0X0000,0X0000,0X0148,0X02B2,0X0106,
+0X0041,0X0000,0X0000,0X0000,0X03FA,0X0000,0X0000,0X0106,
+0X02F3,0X0000,0X0000,0X0148,0X02B2,0X0000,0X0000,0X0000,
+0X022E,0X01AB,0X01AB,0X0270,0X0041,0X0000,0X0106,0X0377,
+0X0000,0X0000,0X0106,0X02F3,0X0000,0X0000,0X0000,0X0335,
+0X016A,0X0000,0X00C5,0X0377,0X0041,0X0000,0X016A,0X02F3,
+0X02F3,0X02B2,0X00C5,0X0000,0X0000,0X00C5,0X022E,0X0000,
+0X0000,0X0000,0X0041,0X0270,0X02F3,0X02B2,0X00C5,0X0000,
+};
+static const unsigned char gSprite_STO_grey[152] = {
+0X0F,0X09,0X05,0X05,0X07,0X0F,0X0A,0X06,0X06,0X06,0X06,0X08,0X0F,0X0E,0X06,0X02,
+0X06,0X0D,0X0F,0X0B,0X06,0X0F,0X0F,0X0A,0X07,0X0F,0X0F,0X0C,0X06,0X0F,0X0F,0X0F,
+0X05,0X0C,0X0F,0X0D,0X04,0X0E,0X0A,0X06,0X0F,0X0F,0X0F,0X0F,0X0F,0X0F,0X0C,0X06,
+0X0F,0X0F,0X0B,0X06,0X0F,0X0F,0X0F,0X08,0X09,0X0F,0X06,0X04,0X07,0X0A,0X0F,0X0F,
+0X0F,0X0C,0X06,0X0F,0X0F,0X09,0X09,0X0F,0X0F,0X0F,0X0C,0X06,0X0F,0X0F,0X0E,0X0A,
+0X06,0X06,0X0F,0X0F,0X0C,0X06,0X0F,0X0F,0X09,0X09,0X0F,0X0F,0X0F,0X0B,0X06,0X0C,
+0X0F,0X0F,0X0F,0X0F,0X02,0X0F,0X0F,0X0C,0X06,0X0F,0X0F,0X0B,0X06,0X0F,0X0F,0X0F,
+0X08,0X0A,0X0A,0X07,0X0F,0X0F,0X0C,0X04,0X0F,0X0F,0X0C,0X06,0X0F,0X0F,0X0F,0X05,
+0X0A,0X0F,0X0D,0X04,0X0F,0X0F,0X0A,0X06,0X06,0X06,0X0D,0X0F,0X0F,0X0D,0X08,0X0F,
+0X0F,0X0F,0X0F,0X07,0X06,0X06,0X0D,0X0F,
+};
+const SPRITE gSprite_STO = { 19, 8, gSprite_STO_runs, gSprite_STO_cx, gSprite_STO_grey };
+
+//19*8, 152 opaque pixels
+static const unsigned char gSprite_RCL_runs[24] = {
+0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,
+0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,
+};
+static const uint16_t gSprite_RCL_cx[152] = {
+0X02F3,0X02F3,0X02F3,0X02B2,0X0148,0X0000,0X0000,0X0148,
+0X0335,0X03B8,0X02B2,0X0041,0X0000,0X016A,0X00C5,0X0000,
+0X0000,0X0000,0X0000,0X02F3,0X0000,0X0000,0X0083,0X0377,
+0X0083,0X00C5,0X0377,0X0083,0X0000,0X016A,0X02F3,0X0000,
+0X01ED,0X0106,0X0000,0X0000,0X0000,0X0000,0X02F3,0X0000,
+0X0000,0X0000,0X02F3,0X0106,0X0270,0X01AB,0X0000,0X0000,
+0X0000,0X022E,0X0000,0X01ED,0X0106,0X0000,0X0000,0X0000,
+0X0000,0X0335,0X0106,0X0106,0X01ED,0X0335,0X0000,0X02F3,
+0X0106,0X0000,0X0000,0X0000,0X0000,0X0000,0X01ED,0X0106,
+0X0000,0X0000,0X0000,0X0000,0X0377,0X01ED,0X01ED,0X03FA,
+0X0041,0X0000,0X02F3,0X0106,0X0000,0X0000,0X0000,0X0000,
+0X0000,0X01ED,0X0106,0X0000,0X0000,0X0000,0X0000,0X02F3,
+0X0000,0X0000,0X0270,0X016A,0X0000,0X022E,0X01AB,0X0000,
+0X0000,0X0000,0X02B2,0X0000,0X01ED,0X0106,0X0000,0X0000,
+0X0000,0X0000,0X02F3,0X0000,0X0000,0X00C5,0X0335,0X0000,
+0X0083,0X0377,0X00C5,0X0000,0X01AB,0X0270,0X0000,0X01ED,
+0X0106,0X0000,0X0000,0X0000,0X0000,0X022E,0X0000,0X0000,
+0X0000,0X0270,0X0083,0X0000,0X0106,0X02F3,0X02F3,0X0270,
+0X0041,0X0000,0X016A,0X02F3,0X02F3,0X02F3,0X02F3,0X0000,
+};
+static const unsigned char gSprite_RCL_grey[152] = {
+0X06,0X06,0X06,0X06,0X0B,0X0F,0X0F,0X0B,0X05,0X03,0X06,0X0F,0X0F,0X0A,0X0D,0X0F,
+0X0F,0X0F,0X0F,0X06,0X0F,0X0F,0X0E,0X04,0X0E,0X0D,0X04,0X0E,0X0F,0X0A,0X06,0X0F,
+0X09,0X0C,0X0F,0X0F,0X0F,0X0F,0X06,0X0F,0X0F,0X0F,0X06,0X0C,0X07,0X0A,0X0F,0X0F,
+0X0F,0X08,0X0F,0X09,0X0C,0X0F,0X0F,0X0F,0X0F,0X05,0X0C,0X0C,0X09,0X05,0X0F,0X06,
+0X0C,0X0F,0X0F,0X0F,0X0F,0X0F,0X09,0X0C,0X0F,0X0F,0X0F,0X0F,0X04,0X09,0X09,0X02,
+0X0F,0X0F,0X06,0X0C,0X0F,0X0F,0X0F,0X0F,0X0F,0X09,0X0C,0X0F,0X0F,0X0F,0X0F,0X06,
+0X0F,0X0F,0X07,0X0A,0X0F,0X08,0X0A,0X0F,0X0F,0X0F,0X06,0X0F,0X09,0X0C,0X0F,0X0F,
+0X0F,0X0F,0X06,0X0F,0X0F,0X0D,0X05,0X0F,0X0E,0X04,0X0D,0X0F,0X0A,0X07,0X0F,0X09,
+0X0C,0X0F,0X0F,0X0F,0X0F,0X08,0X0F,0X0F,0X0F,0X07,0X0E,0X0F,0X0C,0X06,0X06,0X07,
+0X0F,0X0F,0X0A,0X06,0X06,0X06,0X06,0X0F,
+};
+const SPRITE gSprite_RCL = { 19, 8, gSprite_RCL_runs, gSprite_RCL_cx, gSprite_RCL_grey };
+
+//19*8, 152 opaque pixels
+static const unsigned char gSprite_RAD_runs[24] = {
+0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,
+0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,
+};
+static const uint16_t gSprite_RAD_cx[152] = {
+0X02F3,0X02F3,0X02F3,0X02B2,0X0148,0X0000,0X0000,0X0000,
+0X0270,0X016A,0X0000,0X0000,0X0000,0X02F3,0X02F3,0X02F3,
+0X0270,0X00C5,0X0000,0X02F3,0X0000,0X0000,0X0083,0X0377,
+0X0083,0X0000,0X0083,0X0335,0X0335,0X0000,0X0000,0X0000,
+0X03FA,0X0000,0X0000,0X0106,0X0377,0X0083,0X02F3,0X0000,
+0X0000,0X0000,0X02F3,0X0106,0X0000,0X01AB,0X016A,0X0335,
+0X0083,0X0000,0X0000,0X03FA,0X0000,0X0000,0X0000,0X016A,
+0X0270,0X0335,0X0106,0X0106,0X01ED,0X0335,0X0000,0X0000,
+0X02F3,0X0041,0X022E,0X01AB,0X0000,0X0000,0X03FA,0X0000,
+0X0000,0X0000,0X0106,0X02F3,0X0377,0X01ED,0X01ED,0X03FA,
+0X0041,0X0000,0X0041,0X0335,0X0106,0X01AB,0X0335,0X0000,
+0X0000,0X03FA,0X0000,0X0000,0X0000,0X0106,0X02F3,0X02F3,
+0X0000,0X0000,0X0270,0X016A,0X0000,0X016A,0X0270,0X01ED,
+0X01ED,0X0377,0X0083,0X0000,0X03FA,0X0000,0X0000,0X0000,
+0X016A,0X0270,0X02F3,0X0000,0X0000,0X00C5,0X0335,0X0000,
+0X02B2,0X0041,0X0000,0X0000,0X022E,0X01AB,0X0000,0X03FA,
+0X0000,0X0000,0X0148,0X0377,0X0083,0X022E,0X0000,0X0000,
+0X0000,0X0270,0X0083,0X022E,0X0000,0X0000,0X0000,0X00C5,
+0X022E,0X0000,0X02F3,0X02F3,0X02F3,0X0270,0X00C5,0X0000,
+};
+static const unsigned char gSprite_RAD_grey[152] = {
+0X06,0X06,0X06,0X06,0X0B,0X0F,0X0F,0X0F,0X07,0X0A,0X0F,0X0F,0X0F,0X06,0X06,0X06,
+0X07,0X0D,0X0F,0X06,0X0F,0X0F,0X0E,0X04,0X0E,0X0F,0X0E,0X05,0X05,0X0F,0X0F,0X0F,
+0X02,0X0F,0X0F,0X0C,0X04,0X0E,0X06,0X0F,0X0F,0X0F,0X06,0X0C,0X0F,0X0A,0X0A,0X05,
+0X0E,0X0F,0X0F,0X02,0X0F,0X0F,0X0F,0X0A,0X07,0X05,0X0C,0X0C,0X09,0X05,0X0F,0X0F,
+0X06,0X0F,0X08,0X0A,0X0F,0X0F,0X02,0X0F,0X0F,0X0F,0X0C,0X06,0X04,0X09,0X09,0X02,
+0X0F,0X0F,0X0F,0X05,0X0C,0X0A,0X05,0X0F,0X0F,0X02,0X0F,0X0F,0X0F,0X0C,0X06,0X06,
+0X0F,0X0F,0X07,0X0A,0X0F,0X0A,0X07,0X09,0X09,0X04,0X0E,0X0F,0X02,0X0F,0X0F,0X0F,
+0X0A,0X07,0X06,0X0F,0X0F,0X0D,0X05,0X0F,0X06,0X0F,0X0F,0X0F,0X08,0X0A,0X0F,0X02,
+0X0F,0X0F,0X0B,0X04,0X0E,0X08,0X0F,0X0F,0X0F,0X07,0X0E,0X08,0X0F,0X0F,0X0F,0X0D,
+0X08,0X0F,0X06,0X06,0X06,0X07,0X0D,0X0F,
+};
+const SPRITE gSprite_RAD = { 19, 8, gSprite_RAD_runs, gSprite_RAD_cx, gSprite_RAD_grey };
+
+//19*8, 152 opaque pixels
+static const unsigned char gSprite_360_runs[24] = {
+0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,
+0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,
+};
+static const uint16_t gSprite_360_cx[152] = {
+0X0000,0X01ED,0X02B2,0X0335,0X0270,0X0041,0X0000,0X0000,
+0X01ED,0X0335,0X0335,0X01ED,0X0000,0X0000,0X00C5,0X02F3,
+0X02F3,0X022E,0X0041,0X0148,0X02B2,0X0000,0X0000,0X01ED,
+0X01AB,0X0000,0X016A,0X0270,0X0000,0X0000,0X02B2,0X0106,
+0X0041,0X0377,0X0041,0X0000,0X01AB,0X022E,0X0000,0X0000,
+0X0000,0X0000,0X016A,0X01ED,0X0000,0X0335,0X0083,0X0041,
+0X00C5,0X0000,0X0000,0X016A,0X022E,0X0000,0X0000,0X0000,
+0X03B8,0X0000,0X0000,0X01ED,0X022E,0X02F3,0X0041,0X0000,
+0X03FA,0X01ED,0X0270,0X0270,0X02F3,0X0041,0X01ED,0X01ED,
+0X0000,0X0000,0X0000,0X02F3,0X0000,0X0000,0X0106,0X0106,
+0X02B2,0X01AB,0X0000,0X03B8,0X01AB,0X0000,0X0000,0X01ED,
+0X01AB,0X01ED,0X01ED,0X0000,0X0000,0X0000,0X02F3,0X0041,
+0X0000,0X0000,0X0000,0X0041,0X03B8,0X0000,0X0377,0X0041,
+0X0000,0X0000,0X0106,0X01ED,0X016A,0X022E,0X0000,0X0000,
+0X0000,0X03B8,0X022E,0X01ED,0X0000,0X0000,0X01AB,0X02B2,
+0X0000,0X01AB,0X0270,0X0000,0X0041,0X02B2,0X0106,0X0041,
+0X0335,0X00C5,0X0000,0X01AB,0X01ED,0X0000,0X01ED,0X02F3,
+0X02F3,0X0270,0X0041,0X0000,0X0000,0X01ED,0X02F3,0X02F3,
+0X0148,0X0000,0X0000,0X00C5,0X02B2,0X0270,0X022E,0X0000,
+};
+static const unsigned char gSprite_360_grey[152] = {
+0X0F,0X09,0X06,0X05,0X07,0X0F,0X0F,0X0F,0X09,0X05,0X05,0X09,0X0F,0X0F,0X0D,0X06,
+0X06,0X08,0X0F,0X0B,0X06,0X0F,0X0F,0X09,0X0A,0X0F,0X0A,0X07,0X0F,0X0F,0X06,0X0C,
+0X0F,0X04,0X0F,0X0F,0X0A,0X08,0X0F,0X0F,0X0F,0X0F,0X0A,0X09,0X0F,0X05,0X0E,0X0F,
+0X0D,0X0F,0X0F,0X0A,0X08,0X0F,0X0F,0X0F,0X03,0X0F,0X0F,0X09,0X08,0X06,0X0F,0X0F,
+0X02,0X09,0X07,0X07,0X06,0X0F,0X09,0X09,0X0F,0X0F,0X0F,0X06,0X0F,0X0F,0X0C,0X0C,
+0X06,0X0A,0X0F,0X03,0X0A,0X0F,0X0F,0X09,0X0A,0X09,0X09,0X0F,0X0F,0X0F,0X06,0X0F,
+0X0F,0X0F,0X0F,0X0F,0X03,0X0F,0X04,0X0F,0X0F,0X0F,0X0C,0X09,0X0A,0X08,0X0F,0X0F,
+0X0F,0X03,0X08,0X09,0X0F,0X0F,0X0A,0X06,0X0F,0X0A,0X07,0X0F,0X0F,0X06,0X0C,0X0F,
+0X05,0X0D,0X0F,0X0A,0X09,0X0F,0X09,0X06,0X06,0X07,0X0F,0X0F,0X0F,0X09,0X06,0X06,
+0X0B,0X0F,0X0F,0X0D,0X06,0X07,0X08,0X0F,
+};
+const SPRITE gSprite_360 = { 19, 8, gSprite_360_runs, gSprite_360_cx, gSprite_360_grey };
+
+//19*8, 152 opaque pixels
+static const unsigned char gSprite_RPN_runs[24] = {
+0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,0X01,
+0X00,0X13,0X01,0X00,0X13,0X01,0X00,0X13,
+};
+static const uint16_t gSprite_RPN_cx[152] = {
+0X022E,0X02F3,0X02F3,0X02F3,0X01AB,0X0000,0X00C5,0X02F3,
+0X02F3,0X02F3,0X0270,0X0041,0X0000,0X022E,0X01AB,0X0000,
+0X0000,0X0000,0X022E,0X02F3,0X0000,0X0000,0X0041,0X02B2,
+0X016A,0X0106,0X02F3,0X0000,0X0000,0X01ED,0X0270,0X0000,
+0X02F3,0X0377,0X0083,0X0000,0X0000,0X02F3,0X02F3,0X0000,
+0X0000,0X0000,0X01ED,0X01ED,0X0106,0X02F3,0X0000,0X0000,
+0X0106,0X02F3,0X0000,0X02F3,0X0106,0X02B2,0X0000,0X0000,
+0X02F3,0X02F3,0X0106,0X0106,0X016A,0X0377,0X0083,0X0106,
+0X02F3,0X0000,0X0041,0X0270,0X022E,0X0000,0X02F3,0X0000,
+0X02B2,0X0106,0X0000,0X02F3,0X02F3,0X01ED,0X01ED,0X0377,
+0X0148,0X0000,0X0106,0X03B8,0X02F3,0X02F3,0X01AB,0X0000,
+0X0000,0X02F3,0X0000,0X0083,0X0335,0X0000,0X02F3,0X02F3,
+0X0000,0X0000,0X016A,0X0270,0X0000,0X0106,0X02F3,0X0000,
+0X0000,0X0000,0X0000,0X0000,0X02F3,0X0000,0X0000,0X01ED,
+0X01AB,0X02F3,0X02F3,0X0000,0X0000,0X0000,0X03B8,0X0041,
+0X0106,0X02F3,0X0000,0X0000,0X0000,0X0000,0X0000,0X02F3,
+0X0000,0X0000,0X0041,0X0335,0X02F3,0X022E,0X0000,0X0000,
+0X0000,0X01AB,0X0148,0X00C5,0X022E,0X0000,0X0000,0X0000,
+0X0000,0X0000,0X022E,0X0000,0X0000,0X0000,0X0148,0X022E,
+};
+static const unsigned char gSprite_RPN_grey[152] = {
+0X08,0X06,0X06,0X06,0X0A,0X0F,0X0D,0X06,0X06,0X06,0X07,0X0F,0X0F,0X08,0X0A,0X0F,
+0X0F,0X0F,0X08,0X06,0X0F,0X0F,0X0F,0X06,0X0A,0X0C,0X06,0X0F,0X0F,0X09,0X07,0X0F,
+0X06,0X04,0X0E,0X0F,0X0F,0X06,0X06,0X0F,0X0F,0X0F,0X09,0X09,0X0C,0X06,0X0F,0X0F,
+0X0C,0X06,0X0F,0X06,0X0C,0X06,0X0F,0X0F,0X06,0X06,0X0C,0X0C,0X0A,0X04,0X0E,0X0C,
+0X06,0X0F,0X0F,0X07,0X08,0X0F,0X06,0X0F,0X06,0X0C,0X0F,0X06,0X06,0X09,0X09,0X04,
+0X0B,0X0F,0X0C,0X03,0X06,0X06,0X0A,0X0F,0X0F,0X06,0X0F,0X0E,0X05,0X0F,0X06,0X06,
+0X0F,0X0F,0X0A,0X07,0X0F,0X0C,0X06,0X0F,0X0F,0X0F,0X0F,0X0F,0X06,0X0F,0X0F,0X09,
+0X0A,0X06,0X06,0X0F,0X0F,0X0F,0X03,0X0F,0X0C,0X06,0X0F,0X0F,0X0F,0X0F,0X0F,0X06,
+0X0F,0X0F,0X0F,0X05,0X06,0X08,0X0F,0X0F,0X0F,0X0A,0X0B,0X0D,0X08,0X0F,0X0F,0X0F,
+0X0F,0X0F,0X08,0X0F,0X0F,0X0F,0X0B,0X08,
+};
+const SPRITE gSprite_RPN = { 19, 8, gSprite_RPN_runs, gSprite_RPN_cx, gSprite_RPN_grey };
@@ -0,0 +1,25 @@
+#ifndef __SPRITE_H__
+#define __SPRITE_H__
+
+/* Segment bitmaps as runs of opaque pixels, generated into sprite.c from
+ * image.c by tools/mksprite.c.  runs[] holds for each row the number of
+ * runs then a skip and length pair for each, the skip counted from the end
+ * of the previous run.  cx[] and grey[] hold the pixels of all the runs in
+ * order as RGB565 and as classic 4 bit grey.
+ */
+typedef struct
+{
+	unsigned char w, h;
+	const unsigned char *runs;
+	const uint16_t *cx;
+	const unsigned char *grey;
+} SPRITE;
+
+extern const SPRITE gSprite_top, gSprite_lt, gSprite_middle, gSprite_rt;
+extern const SPRITE gSprite_lb, gSprite_bottom, gSprite_rb, gSprite_dot, gSprite_comma;
+extern const SPRITE gSprite_stop, gSprite_slt, gSprite_smiddle, gSprite_srt;
+extern const SPRITE gSprite_slb, gSprite_sbottom, gSprite_srb;
+extern const SPRITE gSprite_lequal, gSprite_sequal, gSprite_arrow, gSprite_input;
+extern const SPRITE gSprite_BEG, gSprite_STO, gSprite_RCL, gSprite_RAD, gSprite_360, gSprite_RPN;
+
+#endif
@@ -21,6 +21,7 @@
 #include "stats.h"
 #include "consts.h"
 #include "int.h"
+#include <os.h>
 
 // #define DUMP1	// Debug output
 
@@ -34,9 +35,6 @@ STAT_DATA *StatRegs;
 #define sigmaN		(StatRegs->sN)
 #define sigmaX		(StatRegs->sX)
 #define sigmaY		(StatRegs->sY)
-#define sigmaX2		(StatRegs->sX2)
-#define sigmaY2		(StatRegs->sY2)
-#define sigmaXY		(StatRegs->sXY)
 #define sigmaX2Y	(StatRegs->sX2Y)
 #define sigmalnX	(StatRegs->slnX)
 #define sigmalnXlnX	(StatRegs->slnXlnX)
@@ -51,6 +49,10 @@ STAT_DATA *StatRegs;
  */
 SMALL_INT SizeStatRegs;
 
+#ifdef LAZY_SIGMA
+static void sigma_discard(void);
+#endif
+
 /*
  *  Handle block (de)allocation
  */
@@ -73,6 +75,7 @@ static int sigmaAllocate(void)
 			return 1;
 		}
 		State.have_stats = 1;
+		State.sigma_moments = 1;
 		sigmaCheck();
 		xset(StatRegs, 0, sizeof(STAT_DATA));
 	}
@@ -80,9 +83,13 @@ static int sigmaAllocate(void)
 }
 
 void sigmaDeallocate(void) {
+#ifdef LAZY_SIGMA
+	sigma_discard();
+#endif
 	move_retstk(SizeStatRegs);
 	SizeStatRegs = 0;
 	State.have_stats = 0;
+	State.sigma_moments = 0;
 }
 
 /*
@@ -92,6 +99,9 @@ int sigmaCopy(void *source)
 {
 	if (sigmaAllocate())
 		return 1;
+#ifdef LAZY_SIGMA
+	sigma_discard();
+#endif
 	xcopy(StatRegs, source, sizeof(STAT_DATA));
 	return 0;
 }
@@ -172,23 +182,11 @@ static void mulop128(decimal128 *r, const decNumber *a, const decNumber *b, decN
 }
 
 
-/* Define a helper function to handle sigma+ and sigma-
+/* Accumulate the logarithmic sums for a data point.
  */
-static void sigma_helper(decNumber *(*op)(decNumber *, const decNumber *, const decNumber *), const decNumber *x, const decNumber *y) {
+static void sigma_log_helper(decNumber *(*op)(decNumber *, const decNumber *, const decNumber *), const decNumber *x, const decNumber *y) {
 	decNumber lx, ly;
 
-	sigop(&sigmaX, x, op);
-	sigop(&sigmaY, y, op);
-	mulop128(&sigmaX2, x, x, op);
-	mulop128(&sigmaY2, y, y, op);
-	mulop128(&sigmaXY, x, y, op);
-
-	decNumberSquare(&lx, x);
-	mulop128(&sigmaX2Y, &lx, y, op);
-
-//	if (UState.sigma_mode == SIGMA_LINEAR)
-//		return;
-
 	dn_ln(&lx, x);
 	dn_ln(&ly, y);
 
@@ -201,6 +199,455 @@ static void sigma_helper(decNumber *(*op)(decNumber *, const decNumber *, const
 	mulop(&sigmaYlnX, y, &lx, op);
 }
 
+/* Central moments of x and y to fourth order and their co-moment.
+ * These are kept up to date as points come and go so that the mean,
+ * deviations, covariance and correlation don't suffer the cancellation
+ * inherent in the power sums.  The means themselves are still best
+ * taken from the sums which are usually exact.  Two sets of moments are combined using
+ * the pairwise update of Chan et al. as extended by Pebay.  A single
+ * point is a set of weight one and Sigma- adds a set of weight minus one.
+ */
+/* The moments are only held to sixteen digits so there is no need to
+ * carry the full working precision when updating them a point at a time.
+ */
+#define MOMENT_DIGITS	(DECIMAL64_Pmax + 4)
+
+typedef struct {
+	decNumber n;
+	decNumber mean[2], m2[2], m3[2], m4[2];
+	decNumber c;
+} MOMENTS;
+
+static void moments_zero(MOMENTS *m) {
+	int k;
+
+	decNumberZero(&m->n);
+	for (k=0; k<2; k++) {
+		decNumberZero(m->mean + k);
+		decNumberZero(m->m2 + k);
+		decNumberZero(m->m3 + k);
+		decNumberZero(m->m4 + k);
+	}
+	decNumberZero(&m->c);
+}
+
+static void moments_unpack(MOMENTS *m, int n) {
+	int k;
+
+	int_to_dn(&m->n, n);
+	for (k=0; k<2; k++) {
+		decimal64ToNumber(StatRegs->sMean + k, m->mean + k);
+		decimal64ToNumber(StatRegs->sM2 + k, m->m2 + k);
+		decimal64ToNumber(StatRegs->sM3 + k, m->m3 + k);
+		decimal64ToNumber(StatRegs->sM4 + k, m->m4 + k);
+	}
+	decimal64ToNumber(&StatRegs->sC, &m->c);
+}
+
+static void moments_pack(const MOMENTS *m) {
+	int k;
+
+	for (k=0; k<2; k++) {
+		packed_from_number(StatRegs->sMean + k, m->mean + k);
+		packed_from_number(StatRegs->sM2 + k, m->m2 + k);
+		packed_from_number(StatRegs->sM3 + k, m->m3 + k);
+		packed_from_number(StatRegs->sM4 + k, m->m4 + k);
+	}
+	packed_from_number(&StatRegs->sC, &m->c);
+}
+
+/* Combine the moments in b into a.
+ */
+static void moments_merge(MOMENTS *a, const MOMENTS *b) {
+	decNumber n, nab, d[2], t, u, v, w, s;
+	int k;
+
+	dn_add(&n, &a->n, &b->n);
+	if (dn_eq0(&n)) {
+		moments_zero(a);
+		return;
+	}
+	dn_multiply(&nab, &a->n, &b->n);
+	for (k=0; k<2; k++) {
+		dn_subtract(d + k, b->mean + k, a->mean + k);
+		dn_divide(&t, d + k, &n);
+		dn_multiply(&u, d + k, &t);
+		dn_multiply(&u, &u, &nab);		// d^2 na nb / n
+
+		// M4 += M4b + u t^2 (na^2 - na nb + nb^2) + 6 t^2 (na^2 M2b + nb^2 M2a) + 4 t (na M3b - nb M3a)
+		decNumberSquare(&v, &a->n);
+		dn_subtract(&s, &v, &nab);
+		decNumberSquare(&w, &b->n);
+		dn_add(&s, &s, &w);
+		dn_multiply(&s, &s, &u);
+		dn_multiply(&v, &v, b->m2 + k);
+		dn_multiply(&w, &w, a->m2 + k);
+		dn_add(&v, &v, &w);
+		dn_multiply(&v, &v, &const_6);
+		dn_add(&s, &s, &v);
+		decNumberSquare(&v, &t);
+		dn_multiply(&s, &s, &v);
+		dn_multiply(&v, &a->n, b->m3 + k);
+		dn_multiply(&w, &b->n, a->m3 + k);
+		dn_subtract(&v, &v, &w);
+		dn_multiply(&v, &v, &t);
+		dn_multiply(&v, &v, &const_4);
+		dn_add(&s, &s, &v);
+		dn_add(&s, &s, b->m4 + k);
+		dn_add(a->m4 + k, a->m4 + k, &s);
+
+		// M3 += M3b + u t (na - nb) + 3 t (na M2b - nb M2a)
+		dn_subtract(&s, &a->n, &b->n);
+		dn_multiply(&s, &s, &u);
+		dn_multiply(&v, &a->n, b->m2 + k);
+		dn_multiply(&w, &b->n, a->m2 + k);
+		dn_subtract(&v, &v, &w);
+		dn_multiply(&v, &v, &const_3);
+		dn_add(&s, &s, &v);
+		dn_multiply(&s, &s, &t);
+		dn_add(&s, &s, b->m3 + k);
+		dn_add(a->m3 + k, a->m3 + k, &s);
+
+		// M2 += M2b + u
+		dn_add(&s, b->m2 + k, &u);
+		dn_add(a->m2 + k, a->m2 + k, &s);
+
+		// mean += nb t
+		dn_multiply(&s, &b->n, &t);
+		dn_add(a->mean + k, a->mean + k, &s);
+	}
+	// C += Cb + dx dy na nb / n
+	dn_multiply(&s, d, d + 1);
+	dn_multiply(&s, &s, &nab);
+	dn_divide(&s, &s, &n);
+	dn_add(&s, &s, &b->c);
+	dn_add(&a->c, &a->c, &s);
+	decNumberCopy(&a->n, &n);
+}
+
+/* Add a single point of weight w, which is one or minus one, to a.
+ * This is the merge above with the higher moments of b being zero.
+ */
+static void moments_add(MOMENTS *a, const decNumber *x, const decNumber *y, int w) {
+	const decNumber *const na = &a->n;
+	decNumber n, nw, q, r, d[2], t[2], u, v, s;
+	int k;
+
+	if (w > 0)
+		dn_p1(&n, na);
+	else {
+		dn_m1(&n, na);
+		if (dn_eq0(&n)) {
+			moments_zero(a);
+			return;
+		}
+	}
+	if (w > 0)
+		decNumberCopy(&nw, na);
+	else
+		dn_minus(&nw, na);
+	decNumberSquare(&v, na);
+	dn_subtract(&q, &v, &nw);
+	dn_p1(&q, &q);				// na^2 - na w + 1
+	dn_subtract(&r, na, w > 0 ? &const_1 : &const__1);
+	for (k=0; k<2; k++) {
+		dn_subtract(d + k, k ? y : x, a->mean + k);
+		dn_divide(t + k, d + k, &n);
+		dn_multiply(&u, d + k, t + k);
+		dn_multiply(&u, &u, &nw);		// d^2 na w / n
+
+		// M4 += u t^2 (na^2 - na w + 1) + 6 t^2 M2 - 4 w t M3
+		dn_multiply(&s, &q, &u);
+		dn_multiply(&v, a->m2 + k, &const_6);
+		dn_add(&s, &s, &v);
+		dn_multiply(&s, &s, t + k);
+		dn_multiply(&v, a->m3 + k, &const_4);
+		if (w > 0)
+			dn_subtract(&s, &s, &v);
+		else
+			dn_add(&s, &s, &v);
+		dn_multiply(&s, &s, t + k);
+		dn_add(a->m4 + k, a->m4 + k, &s);
+
+		// M3 += u t (na - w) - 3 w t M2
+		dn_multiply(&s, &r, &u);
+		dn_multiply(&v, a->m2 + k, &const_3);
+		if (w > 0)
+			dn_subtract(&s, &s, &v);
+		else
+			dn_add(&s, &s, &v);
+		dn_multiply(&s, &s, t + k);
+		dn_add(a->m3 + k, a->m3 + k, &s);
+
+		dn_add(a->m2 + k, a->m2 + k, &u);
+		if (w > 0)
+			dn_add(a->mean + k, a->mean + k, t + k);
+		else
+			dn_subtract(a->mean + k, a->mean + k, t + k);
+	}
+	// C += dx dy na w / n
+	dn_multiply(&s, d, t + 1);
+	dn_multiply(&s, &s, &nw);
+	dn_add(&a->c, &a->c, &s);
+	decNumberCopy(&a->n, &n);
+}
+
+/* Update the stored moments for a point being entered or removed.
+ * The count has been incremented for Sigma+ but not yet decremented
+ * for Sigma-.
+ */
+static void moments_update(int sub, const decNumber *x, const decNumber *y) {
+	const int digits = Ctx.digits;
+	MOMENTS a;
+
+	Ctx.digits = MOMENT_DIGITS;
+	moments_unpack(&a, sub ? sigmaN : sigmaN - 1);
+	moments_add(&a, x, y, sub ? -1 : 1);
+	moments_pack(&a);
+	Ctx.digits = digits;
+}
+
+/* The sums of squares and products other than x^2 y aren't stored, they
+ * follow from the central moments:  sxx = M2 + sx^2 / n,  sxy = C + sx sy / n.
+ * k selects x^2, y^2 or xy.
+ */
+static decNumber *sigma_square(decNumber *r, int k) {
+	decNumber m, s, t, u;
+
+	if (sigmaN == 0)
+		return decNumberZero(r);
+	decimal64ToNumber(k == 2 ? &StatRegs->sC : StatRegs->sM2 + k, &m);
+	decimal64ToNumber(k == 1 ? &sigmaY : &sigmaX, &s);
+	decimal64ToNumber(k == 0 ? &sigmaX : &sigmaY, &t);
+	dn_multiply(&u, &s, &t);
+	int_to_dn(&t, sigmaN);
+	dn_divide(&s, &u, &t);
+	return dn_add(r, &m, &s);
+}
+
+/* Fill the registers from a block saved before the central moments were
+ * kept.  The means, second moments and co-moment follow from the sums.
+ * The third and fourth moments can't be recovered so they are set to NaN,
+ * as are skewness and kurtosis until the registers are cleared.
+ */
+static void sigma_from_v0(const STAT_DATA_V0 *old) {
+	MOMENTS m;
+	decNumber s[2], t, u;
+	int k;
+
+	xset(StatRegs, 0, sizeof(STAT_DATA));
+	sigmaX2Y = old->sX2Y;
+	xcopy(&sigmaX, &old->sX, 9 * sizeof(decimal64));
+	sigmaN = old->sN;
+	if (sigmaN == 0)
+		return;
+	int_to_dn(&m.n, sigmaN);
+	decimal64ToNumber(&old->sX, s);
+	decimal64ToNumber(&old->sY, s + 1);
+	for (k=0; k<2; k++) {
+		dn_divide(m.mean + k, s + k, &m.n);
+		decimal128ToNumber(k ? &old->sY2 : &old->sX2, &t);
+		dn_multiply(&u, s + k, m.mean + k);
+		dn_subtract(m.m2 + k, &t, &u);
+		set_NaN(m.m3 + k);
+		set_NaN(m.m4 + k);
+	}
+	decimal128ToNumber(&old->sXY, &t);
+	dn_multiply(&u, s, m.mean + 1);
+	dn_subtract(&m.c, &t, &u);
+	moments_pack(&m);
+}
+
+/* Load the registers from a block in the old layout.
+ */
+int sigmaCopyV0(void *source) {
+	STAT_DATA_V0 old;
+
+	xcopy(&old, source, sizeof(old));
+	if (sigmaAllocate())
+		return 1;
+#ifdef LAZY_SIGMA
+	sigma_discard();
+#endif
+	sigma_from_v0(&old);
+	return 0;
+}
+
+/* The block in RAM is in the old layout, make room for the current one
+ * and convert it.  If there is no room the block is released.
+ */
+void sigmaUpgrade(void) {
+	STAT_DATA_V0 old;
+
+	sigmaCheck();
+	xcopy(&old, StatRegs, sizeof(old));
+	if (move_retstk(-(int) ((sizeof(STAT_DATA) - sizeof(old)) >> 1))) {
+		sigmaDeallocate();
+		return;
+	}
+	SizeStatRegs = sizeof(STAT_DATA) >> 1;
+	State.sigma_moments = 1;
+	sigmaCheck();
+	sigma_from_v0(&old);
+}
+
+#ifdef LAZY_SIGMA
+/* The logarithmic sums are only needed by the non-linear fits.  Until one
+ * of those is asked for, Sigma+ in linear mode records the data points here
+ * and the logarithms are accumulated in one go when first required.  From
+ * then on they are kept up to date as each point is entered.  Sigma- of
+ * a pending point simply drops it.  The pending points are forgotten if
+ * the summation registers are replaced underneath us, which is detected
+ * using a copy of some of the sums.
+ */
+#define SIGMA_PENDING_MAX	65536		/* 1MB */
+
+static struct {
+	decimal64 (*xy)[2];
+	int n, size;
+	int eager;
+	decimal64 sX, sY, sC;
+} SigmaPending;
+
+static void sigma_discard(void) {
+	free(SigmaPending.xy);
+	SigmaPending.xy = NULL;
+	SigmaPending.n = SigmaPending.size = 0;
+	SigmaPending.eager = 0;
+}
+
+/* Forget the pending points if they don't belong to the current sums.
+ */
+static void sigma_validate(void) {
+	if (SigmaPending.n == 0)
+		return;
+	if (SizeStatRegs == 0 || sigmaCheck()
+			|| xcmp(&SigmaPending.sX, &sigmaX, sizeof(decimal64))
+			|| xcmp(&SigmaPending.sY, &sigmaY, sizeof(decimal64))
+			|| xcmp(&SigmaPending.sC, &StatRegs->sC, sizeof(decimal64)))
+		SigmaPending.n = 0;
+}
+
+static void sigma_replay(void) {
+	decNumber x, y;
+	int i;
+
+	for (i=0; i<SigmaPending.n; i++) {
+		decimal64ToNumber(&SigmaPending.xy[i][0], &x);
+		decimal64ToNumber(&SigmaPending.xy[i][1], &y);
+		sigma_log_helper(&dn_add, &x, &y);
+	}
+	SigmaPending.n = 0;
+}
+
+/* Bring the logarithmic sums up to date.  This must be done before the
+ * summation registers leave the machine.
+ */
+void sigma_flush(void) {
+	sigma_validate();
+	sigma_replay();
+}
+
+/* The logarithmic sums are wanted.  Bring them up to date and keep them
+ * that way.
+ */
+static void sigma_want_logs(void) {
+	sigma_flush();
+	free(SigmaPending.xy);
+	SigmaPending.xy = NULL;
+	SigmaPending.size = 0;
+	SigmaPending.eager = 1;
+}
+
+/* Record a data point.  If there is no room, the pending points are
+ * accumulated instead and zero returned.
+ */
+static int sigma_record(const decNumber *x, const decNumber *y) {
+	int n;
+
+	if (SigmaPending.n == SIGMA_PENDING_MAX)
+		sigma_replay();
+	n = SigmaPending.n;
+	if (n == SigmaPending.size) {
+		const int size = n == 0 ? 16 : 2 * n;
+		decimal64 (*p)[2] = realloc(SigmaPending.xy, size * sizeof(*p));
+
+		if (p == NULL) {
+			sigma_replay();
+			return 0;
+		}
+		SigmaPending.xy = p;
+		SigmaPending.size = size;
+	}
+	packed_from_number(&SigmaPending.xy[n][0], x);
+	packed_from_number(&SigmaPending.xy[n][1], y);
+	SigmaPending.n = n + 1;
+	return 1;
+}
+
+/* Remove a data point from the pending list, most likely it was the last
+ * one entered.  Return zero if it isn't there.
+ */
+static int sigma_unrecord(const decNumber *x, const decNumber *y) {
+	decimal64 xy[2];
+	int i;
+
+	packed_from_number(&xy[0], x);
+	packed_from_number(&xy[1], y);
+	for (i=SigmaPending.n-1; i>=0; i--)
+		if (xcmp(SigmaPending.xy[i], xy, sizeof(xy)) == 0) {
+			xcopy(SigmaPending.xy[i], SigmaPending.xy[i+1], (SigmaPending.n - i - 1) * sizeof(xy));
+			SigmaPending.n--;
+			return 1;
+		}
+	return 0;
+}
+
+/* Decide if the logarithms for a data point can be put off.  This is
+ * called before the sums are updated.
+ */
+static int sigma_defer(decNumber *(*op)(decNumber *, const decNumber *, const decNumber *), const decNumber *x, const decNumber *y) {
+	const int lazy = ! SigmaPending.eager && UState.sigma_mode == SIGMA_LINEAR;
+
+	sigma_validate();
+	if (lazy && (op == &dn_add || sigma_unrecord(x, y)))
+		return 1;
+	sigma_replay();
+	return 0;
+}
+
+/* Called after the sums have been updated for a deferred point.
+ */
+static void sigma_snapshot(void) {
+	SigmaPending.sX = sigmaX;
+	SigmaPending.sY = sigmaY;
+	SigmaPending.sC = StatRegs->sC;
+}
+#endif
+
+/* Define a helper function to handle sigma+ and sigma-
+ */
+static void sigma_helper(decNumber *(*op)(decNumber *, const decNumber *, const decNumber *), const decNumber *x, const decNumber *y) {
+	decNumber x2;
+#ifdef LAZY_SIGMA
+	const int defer = sigma_defer(op, x, y);
+#endif
+
+	sigop(&sigmaX, x, op);
+	sigop(&sigmaY, y, op);
+	decNumberSquare(&x2, x);
+	mulop128(&sigmaX2Y, &x2, y, op);
+	moments_update(op != &dn_add, x, y);
+
+#ifdef LAZY_SIGMA
+	if (defer && (op != &dn_add || sigma_record(x, y))) {
+		sigma_snapshot();
+		return;
+	}
+#endif
+	sigma_log_helper(op, x, y);
+}
+
 static void sigma_helper_xy(decNumber *(*op)(decNumber *, const decNumber *, const decNumber *)) {
 	decNumber x, y;
 
@@ -236,6 +683,174 @@ int sigma_plus_x( const decNumber *x) {
 	return sigmaN;
 }
 
+/* Bulk accumulation.  The sums are held unpacked for the duration and
+ * packed again once at the end.  This is quicker and more accurate than
+ * entering the points one at a time.  The moments of the block are
+ * gathered separately and merged into the stored ones at the end.
+ */
+enum {
+	SB_X2Y,					// decimal128
+	SB_X, SB_Y,
+	SB_LNX, SB_LNXLNX, SB_LNY, SB_LNYLNY, SB_LNXLNY, SB_XLNY, SB_YLNX,
+	SB_NUM
+};
+
+static struct {
+	decNumber s[SB_NUM];
+	MOMENTS m;
+	int logs;
+} SigmaBulk;
+
+static void sigma_bulk_unpack(int lo, int hi) {
+	int i;
+
+	for (i=lo; i<hi; i++)
+		if (i == SB_X2Y)
+			decimal128ToNumber(&sigmaX2Y, SigmaBulk.s + i);
+		else
+			decimal64ToNumber(&sigmaX + (i - SB_X), SigmaBulk.s + i);
+}
+
+static int sigma_bulk_begin(void) {
+	if (sigmaAllocate())
+		return 1;
+	busy();
+#ifdef LAZY_SIGMA
+	SigmaBulk.logs = ! sigma_defer(&dn_add, NULL, NULL);
+#else
+	SigmaBulk.logs = 1;
+#endif
+	sigma_bulk_unpack(0, SigmaBulk.logs ? SB_NUM : SB_LNX);
+	moments_zero(&SigmaBulk.m);
+	return 0;
+}
+
+static void sigma_bulk_add(const decNumber *x, const decNumber *y) {
+	const int digits = Ctx.digits;
+	decNumber *const s = SigmaBulk.s;
+	decNumber t, lx, ly;
+
+	++sigmaN;
+	Ctx.digits = MOMENT_DIGITS;
+	moments_add(&SigmaBulk.m, x, y, 1);
+	Ctx.digits = digits;
+	dn_add(s + SB_X, s + SB_X, x);
+	dn_add(s + SB_Y, s + SB_Y, y);
+	decNumberSquare(&t, x);
+	dn_add(s + SB_X2Y, s + SB_X2Y, dn_multiply(&lx, &t, y));
+
+#ifdef LAZY_SIGMA
+	if (! SigmaBulk.logs) {
+		if (sigma_record(x, y))
+			return;
+		SigmaBulk.logs = 1;
+		sigma_bulk_unpack(SB_LNX, SB_NUM);
+	}
+#endif
+	dn_ln(&lx, x);
+	dn_ln(&ly, y);
+	dn_add(s + SB_LNX, s + SB_LNX, &lx);
+	dn_add(s + SB_LNY, s + SB_LNY, &ly);
+	dn_add(s + SB_LNXLNX, s + SB_LNXLNX, decNumberSquare(&t, &lx));
+	dn_add(s + SB_LNYLNY, s + SB_LNYLNY, decNumberSquare(&t, &ly));
+	dn_add(s + SB_LNXLNY, s + SB_LNXLNY, dn_multiply(&t, &lx, &ly));
+	dn_add(s + SB_XLNY, s + SB_XLNY, dn_multiply(&t, x, &ly));
+	dn_add(s + SB_YLNX, s + SB_YLNX, dn_multiply(&t, y, &lx));
+}
+
+static void sigma_bulk_end(void) {
+	const int n = SigmaBulk.logs ? SB_NUM : SB_LNX;
+	MOMENTS a;
+	int i;
+
+	moments_unpack(&a, sigmaN - dn_to_int(&SigmaBulk.m.n));
+	moments_merge(&a, &SigmaBulk.m);
+	moments_pack(&a);
+
+	for (i=0; i<n; i++)
+		if (i == SB_X2Y)
+			packed128_from_number(&sigmaX2Y, SigmaBulk.s + i);
+		else
+			packed_from_number(&sigmaX + (i - SB_X), SigmaBulk.s + i);
+#ifdef LAZY_SIGMA
+	if (! SigmaBulk.logs)
+		sigma_snapshot();
+#endif
+}
+
+/* Accumulate the pairs from two register blocks as given by sss.nnddd in X.
+ * The x values come from the source block and the y values from the
+ * destination block, as for R-COPY.
+ */
+void sigma_regs(enum nilop op) {
+	decNumber x, y;
+	int s, n, d, i;
+
+	if (reg_decode(&s, &n, &d, 0) || sigma_bulk_begin())
+		return;
+	for (i=0; i<n; i++) {
+		getRegister(&x, s + i);
+		getRegister(&y, d + i);
+		sigma_bulk_add(&x, &y);
+	}
+	sigma_bulk_end();
+}
+
+#ifdef INCLUDE_SIGMA_CSV
+/* Parse a number from a CSV field and return a pointer past the field
+ * separator or NULL if the field isn't a number.
+ */
+static const char *csv_number(decNumber *r, const char *p) {
+	decContext ctx = Ctx;
+	char buf[64];
+	int i = 0;
+
+	while (*p == ' ' || *p == '\t' || *p == '"')
+		p++;
+	while (*p != '\0' && *p != ',' && *p != ';' && *p != '"' && *p > ' ' && i < (int) sizeof(buf) - 1)
+		buf[i++] = *p++;
+	buf[i] = '\0';
+	ctx.status = 0;
+	decNumberFromString(r, buf, &ctx);
+	if (i == 0 || (ctx.status & DEC_Conversion_syntax))
+		return NULL;
+	while (*p == ' ' || *p == '\t' || *p == '"')
+		p++;
+	if (*p == ',' || *p == ';')
+		p++;
+	return p;
+}
+
+/* Accumulate the x,y pairs from the CSV file named in Alpha.  Lines that
+ * don't start with a number, such as headings, are skipped.  A missing
+ * y value is taken as zero.
+ */
+void sigma_csv(enum nilop op) {
+	char line[256];
+	decNumber x, y;
+	const char *p;
+	FILE *f;
+
+	f = fopen(Alpha, "r");
+	if (f == NULL) {
+		err(ERR_IO);
+		return;
+	}
+	if (! sigma_bulk_begin()) {
+		while (fgets(line, sizeof(line), f) != NULL) {
+			p = csv_number(&x, line);
+			if (p == NULL)
+				continue;
+			if (csv_number(&y, p) == NULL)
+				decNumberZero(&y);
+			sigma_bulk_add(&x, &y);
+		}
+		sigma_bulk_end();
+	}
+	fclose(f);
+}
+#endif
+
 /* Loop through the various modes and work out
  * which has the highest absolute correlation.
  */
@@ -306,6 +921,10 @@ static enum sigma_modes get_sigmas(decNumber *N, decNumber *sx, decNumber *sy,
 		break;
 	}
 
+#ifdef LAZY_SIGMA
+	if (lnx || lny)
+		sigma_want_logs();
+#endif
 	if (N != NULL)
 		int_to_dn(N, sigmaN);
 	if (sx != NULL)
@@ -316,24 +935,28 @@ static enum sigma_modes get_sigmas(decNumber *N, decNumber *sx, decNumber *sy,
 		if (lnx)
 			decimal64ToNumber(&sigmalnXlnX, sxx);
 		else
-			decimal128ToNumber(&sigmaX2, sxx);
+			sigma_square(sxx, 0);
 	}
 	if (syy != NULL) {
 		if (lny)
 			decimal64ToNumber(&sigmalnYlnY, syy);
 		else
-			decimal128ToNumber(&sigmaY2, syy);
+			sigma_square(syy, 1);
 	}
 	if (sxy != NULL) {
 		if (lnx || lny)
 			decimal64ToNumber(xy, sxy);
 		else
-			decimal128ToNumber(&sigmaXY, sxy);
+			sigma_square(sxy, 2);
 	}
 	return mode;
 }
 
 
+static int is_linear(enum sigma_modes m) {
+	return m == SIGMA_LINEAR || m == SIGMA_QUIET_LINEAR;
+}
+
 /*
  *  Return a summation register to the user.
  *  Opcodes have been reaaranged to move sigmaN to the end of the list.
@@ -353,14 +976,26 @@ void sigma_val(enum nilop op) {
 		else
 			setX_int_sgn( -sigmaN, 1);
 	}
+	else if (op == OP_sigmaX2Y) {
+		if (dbl)
+			x->d = sigmaX2Y;
+		else
+			packed_from_packed128(&(x->s), &sigmaX2Y);
+	}
 	else if (op < OP_sigmaX) {
-		decimal128 *d = (&sigmaX2Y) + (op - OP_sigmaX2Y);
+		decNumber r;
+
+		sigma_square(&r, op - OP_sigmaX2);
 		if (dbl)
-			x->d = *d;
+			packed128_from_number(&(x->d), &r);
 		else
-			packed_from_packed128(&(x->s), d);
+			packed_from_number(&(x->s), &r);
 	}
 	else {
+#ifdef LAZY_SIGMA
+		if (op >= OP_sigmalnX)
+			sigma_want_logs();
+#endif
 		x->s = (&sigmaX)[op - OP_sigmaX];
 		if (dbl)
 			packed128_from_packed(&(x->d), &(x->s));
@@ -432,17 +1067,13 @@ void stats_gmean(enum nilop op) {
 	mean_common(regY_idx, &sy, &N, 1);
 }
 
-// Standard deviations and standard errors
-static void do_s(int index,
-		const decNumber *sxx, const decNumber *sx,
+// Standard deviations and standard errors from the sum of squared deviations
+static void do_s(int index, const decNumber *ss,
 		const decNumber *N, const decNumber *denom, 
 		int rootn, int exp) {
 	decNumber t, u, v, *p = &t;
 
-	decNumberSquare(&t, sx);
-	dn_divide(&u, &t, N);
-	dn_subtract(&t, sxx, &u);
-	dn_divide(&u, &t, denom);
+	dn_divide(&u, ss, denom);
 	if (dn_le0(&u))
 		decNumberZero(&t);
 	else
@@ -459,10 +1090,20 @@ static void do_s(int index,
 	setRegister(index, p);
 }
 
+// sxx - sx^2 / n
+static void sum_squares(decNumber *r, const decNumber *sxx, const decNumber *sx, const decNumber *N) {
+	decNumber t, u;
+
+	decNumberSquare(&t, sx);
+	dn_divide(&u, &t, N);
+	dn_subtract(r, sxx, &u);
+}
+
 // sx = sqrt(sigmaX^2 - (sigmaX ^ 2 ) / (n-1))
 void stats_deviations(enum nilop op) {
 	decNumber N, nm1, *n = &N;
-	decNumber sx, sxx, sy, syy;
+	decNumber sx, sxx, sy, syy, ssx, ssy;
+	MOMENTS m;
 	int sample = 1, rootn = 0, exp = 0;
 
 	if (check_data(2))
@@ -475,11 +1116,20 @@ void stats_deviations(enum nilop op) {
 	if (op == OP_statGS || op == OP_statGSigma || op == OP_statGSErr)
 		exp = 1;
 
-	get_sigmas(&N, &sx, &sy, &sxx, &syy, NULL, exp?SIGMA_QUIET_POWER:SIGMA_QUIET_LINEAR);
+	if (exp) {
+		get_sigmas(&N, &sx, &sy, &sxx, &syy, NULL, SIGMA_QUIET_POWER);
+		sum_squares(&ssx, &sxx, &sx, &N);
+		sum_squares(&ssy, &syy, &sy, &N);
+	} else {
+		moments_unpack(&m, sigmaN);
+		decNumberCopy(&N, &m.n);
+		decNumberCopy(&ssx, m.m2);
+		decNumberCopy(&ssy, m.m2 + 1);
+	}
 	if (sample)
 		dn_m1(n = &nm1, &N);
-	do_s(regX_idx, &sxx, &sx, &N, n, rootn, exp);
-	do_s(regY_idx, &syy, &sy, &N, n, rootn, exp);
+	do_s(regX_idx, &ssx, &N, n, rootn, exp);
+	do_s(regY_idx, &ssy, &N, n, rootn, exp);
 }
 
 
@@ -535,21 +1185,27 @@ decNumber *stats_sigper(decNumber *res, const decNumber *x) {
 static void correlation(decNumber *t, const enum sigma_modes m) {
 	decNumber N, u, v, w;
 	decNumber sx, sy, sxx, syy, sxy;
+	MOMENTS mo;
 
-	get_sigmas(&N, &sx, &sy, &sxx, &syy, &sxy, m);
-
-	dn_multiply(t, &N, &sxx);
-	decNumberSquare(&u, &sx);
-	dn_subtract(&v, t, &u);
-	dn_multiply(t, &N, &syy);
-	decNumberSquare(&u, &sy);
-	dn_subtract(&w, t, &u);
-	dn_multiply(t, &v, &w);
-	dn_sqrt(&w, t);
-	dn_multiply(t, &N, &sxy);
-	dn_multiply(&u, &sx, &sy);
-	dn_subtract(&v, t, &u);
-	dn_divide(t, &v, &w);
+	if (is_linear(get_sigmas(&N, &sx, &sy, &sxx, &syy, &sxy, m))) {
+		moments_unpack(&mo, sigmaN);
+		dn_multiply(&u, mo.m2, mo.m2 + 1);
+		dn_sqrt(&w, &u);
+		dn_divide(t, &mo.c, &w);
+	} else {
+		dn_multiply(t, &N, &sxx);
+		decNumberSquare(&u, &sx);
+		dn_subtract(&v, t, &u);
+		dn_multiply(t, &N, &syy);
+		decNumberSquare(&u, &sy);
+		dn_subtract(&w, t, &u);
+		dn_multiply(t, &v, &w);
+		dn_sqrt(&w, t);
+		dn_multiply(t, &N, &sxy);
+		dn_multiply(&u, &sx, &sy);
+		dn_subtract(&v, t, &u);
+		dn_divide(t, &v, &w);
+	}
 
 	if (dn_gt(t, &const_1))
 		dn_1(t);
@@ -572,13 +1228,18 @@ void stats_COV(enum nilop op) {
 	const int sample = (op == OP_statCOV) ? 0 : 1;
 	decNumber N, t, u, v;
 	decNumber sx, sy, sxy;
+	MOMENTS m;
 
 	if (check_data(2))
 		return;
-	get_sigmas(&N, &sx, &sy, NULL, NULL, &sxy, (enum sigma_modes) UState.sigma_mode);
-	dn_multiply(&t, &sx, &sy);
-	dn_divide(&u, &t, &N);
-	dn_subtract(&t, &sxy, &u);
+	if (is_linear(get_sigmas(&N, &sx, &sy, NULL, NULL, &sxy, (enum sigma_modes) UState.sigma_mode))) {
+		moments_unpack(&m, sigmaN);
+		decNumberCopy(&t, &m.c);
+	} else {
+		dn_multiply(&t, &sx, &sy);
+		dn_divide(&u, &t, &N);
+		dn_subtract(&t, &sxy, &u);
+	}
 	if (sample) {
 		dn_m1(&v, &N);
 		dn_divide(&u, &t, &v);
@@ -593,8 +1254,17 @@ static enum sigma_modes do_LR(decNumber *B, decNumber *A) {
 	decNumber N, u, v, denom;
 	decNumber sx, sy, sxx, sxy;
 	enum sigma_modes m;
+	MOMENTS mo;
 
 	m = get_sigmas(&N, &sx, &sy, &sxx, NULL, &sxy, (enum sigma_modes) UState.sigma_mode);
+	if (is_linear(m)) {
+		moments_unpack(&mo, sigmaN);
+		dn_divide(A, &mo.c, mo.m2);
+		dn_multiply(&u, A, &sx);
+		dn_subtract(&v, &sy, &u);
+		dn_divide(B, &v, &N);
+		return m;
+	}
 
 	dn_multiply(B, &N, &sxx);
 	decNumberSquare(&u, &sx);
@@ -628,6 +1298,53 @@ void stats_LR(enum nilop op) {
 }
 
 
+/* Sample skewness and excess kurtosis from the central moments:
+ *	G1 = n sqrt(n-1) M3 / ((n-2) M2^1.5)
+ *	G2 = ((n+1) (n M4 / M2^2 - 3) + 6) (n-1) / ((n-2) (n-3))
+ */
+static void shape_common(int index, const MOMENTS *m, int k, int kurt) {
+	const decNumber *n = &m->n;
+	decNumber t, u, v, w;
+
+	dn_subtract(&w, n, &const_2);
+	if (kurt) {
+		decNumberSquare(&t, m->m2 + k);
+		dn_divide(&u, m->m4 + k, &t);
+		dn_multiply(&t, &u, n);
+		dn_subtract(&u, &t, &const_3);
+		dn_p1(&t, n);
+		dn_multiply(&v, &u, &t);
+		dn_add(&u, &v, &const_6);
+		dn_m1(&t, n);
+		dn_multiply(&v, &u, &t);
+		dn_subtract(&t, n, &const_3);
+		dn_multiply(&u, &w, &t);
+	} else {
+		dn_sqrt(&t, m->m2 + k);
+		dn_multiply(&u, &t, m->m2 + k);
+		dn_multiply(&t, &u, &w);
+		dn_m1(&w, n);
+		dn_sqrt(&u, &w);
+		dn_multiply(&w, &u, n);
+		dn_multiply(&v, &w, m->m3 + k);
+		decNumberCopy(&u, &t);
+	}
+	dn_divide(&t, &v, &u);
+	setRegister(index, &t);
+}
+
+void stats_shape(enum nilop op) {
+	const int kurt = (op == OP_statKURT);
+	MOMENTS m;
+
+	if (check_data(kurt ? 4 : 3))
+		return;
+	moments_unpack(&m, sigmaN);
+	shape_common(regX_idx, &m, 0, kurt);
+	shape_common(regY_idx, &m, 1, kurt);
+}
+
+
 decNumber *stats_xhat(decNumber *res, const decNumber *y) {
 	decNumber a, b, t, u;
 	enum sigma_modes m;
@@ -692,6 +1409,258 @@ decNumber *stats_yhat(decNumber *res, const decNumber *x) {
 }
 
 
+/* Order statistics over the register block given by sss.nn in X.  The
+ * block is unpacked once into an array and the wanted element located
+ * by introselect: quickselect on a median of three pivot, falling back
+ * to a heap sort of the remaining range if the partitioning stops making
+ * progress.  The registers themselves are left in place.
+ */
+#define ORDER_SMALL	8
+
+typedef struct {
+	decNumber **p;
+	int n;
+} OrderBlock;
+
+static int order_unpack(OrderBlock *b, const decNumber *blk) {
+	decNumber *keys;
+	int s, n, i;
+
+	if (reg_decode_dn(blk, &s, &n, NULL, 0))
+		return 1;
+	b->p = malloc(n * (sizeof(decNumber *) + sizeof(decNumber)));
+	if (b->p == NULL) {
+		err(ERR_RAM_FULL);
+		return 1;
+	}
+	keys = (decNumber *) (b->p + n);
+	b->n = n;
+	for (i=0; i<n; i++) {
+		getRegister(keys + i, s + i);
+		if (decNumberIsNaN(keys + i)) {
+			free(b->p);
+			return 1;
+		}
+		b->p[i] = keys + i;
+	}
+	return 0;
+}
+
+static void order_swap(decNumber **p, int i, int j) {
+	decNumber *const t = p[i];
+
+	p[i] = p[j];
+	p[j] = t;
+}
+
+static void order_sift(decNumber **p, int i, int n) {
+	int k;
+
+	while ((k = 2 * i + 1) < n) {
+		if (k + 1 < n && dn_lt(p[k], p[k + 1]))
+			k++;
+		if (! dn_lt(p[i], p[k]))
+			break;
+		order_swap(p, i, k);
+		i = k;
+	}
+}
+
+static void order_sort(decNumber **p, int n) {
+	decNumber *t;
+	int i, j;
+
+	if (n <= ORDER_SMALL) {
+		for (i=1; i<n; i++) {
+			t = p[i];
+			for (j=i; j>0 && dn_lt(t, p[j-1]); j--)
+				p[j] = p[j-1];
+			p[j] = t;
+		}
+		return;
+	}
+	for (i=n/2-1; i>=0; i--)
+		order_sift(p, i, n);
+	for (i=n-1; i>0; i--) {
+		order_swap(p, 0, i);
+		order_sift(p, 0, i);
+	}
+}
+
+/* Rearrange the block so that the k-th smallest (from zero) is in place
+ * with nothing larger before it and nothing smaller after.
+ */
+static const decNumber *order_select(OrderBlock *b, int k) {
+	decNumber **p = b->p, *pv;
+	int n = b->n, i, j, depth;
+
+	for (depth = 0, i = n; i > 1; i >>= 1)
+		depth += 2;
+	while (n > ORDER_SMALL) {
+		if (depth-- == 0)
+			break;
+		j = n / 2;
+		if (dn_lt(p[j], p[0]))
+			order_swap(p, 0, j);
+		if (dn_lt(p[n-1], p[j])) {
+			order_swap(p, j, n-1);
+			if (dn_lt(p[j], p[0]))
+				order_swap(p, 0, j);
+		}
+		pv = p[j];
+		i = 0;
+		j = n - 1;
+		for (;;) {
+			while (dn_lt(p[++i], pv));
+			while (dn_lt(pv, p[--j]));
+			if (i >= j)
+				break;
+			order_swap(p, i, j);
+		}
+		if (k < i)
+			n = i;
+		else {
+			p += i;
+			n -= i;
+			k -= i;
+		}
+	}
+	order_sort(p, n);
+	return p[k];
+}
+
+/* Smallest or largest of the elements from lo onwards.
+ */
+static const decNumber *order_extreme(const OrderBlock *b, int lo, int largest) {
+	const decNumber *r = b->p[lo];
+	int i;
+
+	for (i=lo+1; i<b->n; i++)
+		if (largest ? dn_lt(r, b->p[i]) : dn_lt(b->p[i], r))
+			r = b->p[i];
+	return r;
+}
+
+static decNumber *order_extreme_x(decNumber *r, const decNumber *blk, int largest) {
+	OrderBlock b;
+
+	if (order_unpack(&b, blk))
+		return NULL;
+	decNumberCopy(r, order_extreme(&b, 0, largest));
+	free(b.p);
+	return r;
+}
+
+decNumber *stats_regmin(decNumber *r, const decNumber *x) {
+	return order_extreme_x(r, x, 0);
+}
+
+decNumber *stats_regmax(decNumber *r, const decNumber *x) {
+	return order_extreme_x(r, x, 1);
+}
+
+// k-th smallest, k from one
+decNumber *stats_regkth(decNumber *r, const decNumber *k, const decNumber *x) {
+	OrderBlock b;
+	int i;
+
+	if (! is_int(k)) {
+		err(ERR_DOMAIN);
+		return NULL;
+	}
+	if (order_unpack(&b, x))
+		return NULL;
+	i = dn_to_int(k);
+	if (i < 1 || i > b.n) {
+		err(ERR_RANGE);
+		r = NULL;
+	} else
+		decNumberCopy(r, order_select(&b, i - 1));
+	free(b.p);
+	return r;
+}
+
+/* Quantile p of the block using Hyndman and Fan's definition of the given
+ * type (1 to 9).  With h = n p + m and j = floor(h), the result is
+ *	x[j] + gamma (x[j+1] - x[j])
+ * where the offset m and the weight gamma depend on the type.  Type 7 is
+ * the usual linear interpolation, type 6 the Minitab and SPSS one and
+ * type 1 the inverse of the empirical distribution function.
+ */
+static decNumber *order_quantile(decNumber *r, const decNumber *p, int type, const decNumber *blk) {
+	OrderBlock b;
+	decNumber h, g, m, t, u;
+	const decNumber *gamma = &g;
+	const decNumber *xj;
+	int j;
+
+	if (type < 1 || type > 9 || dn_lt0(p) || dn_gt(p, &const_1)) {
+		err(ERR_DOMAIN);
+		return NULL;
+	}
+	if (order_unpack(&b, blk))
+		return NULL;
+
+	int_to_dn(&t, b.n);
+	dn_multiply(&u, &t, p);
+	switch (type) {
+	case 3:	dn_subtract(&h, &u, &const_0_5);	break;
+	case 5:	dn_add(&h, &u, &const_0_5);		break;
+	case 6:	dn_add(&h, &u, p);			break;
+	case 7:	dn_1m(&m, p);
+		dn_add(&h, &u, &m);			break;
+	case 8:	// ((3n + 1) p + 1) / 3 rounded once
+		dn_multiply(&m, &u, &const_3);
+		dn_add(&t, &m, p);
+		dn_p1(&m, &t);
+		dn_divide(&h, &m, &const_3);		break;
+	case 9:	dn_mul2(&t, p);
+		dn_add(&m, &t, &const_3);
+		dn_divide(&t, &m, &const_8);
+		dn_add(&h, &u, &t);			break;
+	default:
+		decNumberCopy(&h, &u);			break;
+	}
+	decNumberFloor(&t, &h);
+	dn_subtract(&g, &h, &t);
+	j = dn_to_int(&t);
+
+	if (type == 1 || type == 2)
+		gamma = dn_eq0(&g) ? (type == 1 ? &const_0 : &const_0_5) : &const_1;
+	else if (type == 3)
+		gamma = dn_eq0(&g) && (j & 1) == 0 ? &const_0 : &const_1;
+
+	if (j < 1)
+		decNumberCopy(r, order_extreme(&b, 0, 0));
+	else if (j >= b.n)
+		decNumberCopy(r, order_extreme(&b, 0, 1));
+	else {
+		xj = order_select(&b, j - 1);
+		if (dn_eq0(gamma))
+			decNumberCopy(r, xj);
+		else {
+			dn_subtract(&t, order_extreme(&b, j, 0), xj);
+			dn_multiply(&u, &t, gamma);
+			dn_add(r, xj, &u);
+		}
+	}
+	free(b.p);
+	return r;
+}
+
+decNumber *stats_regmedian(decNumber *r, const decNumber *x) {
+	return order_quantile(r, &const_0_5, 7, x);
+}
+
+decNumber *stats_regquantile(decNumber *r, const decNumber *type, const decNumber *p, const decNumber *x) {
+	if (! is_int(type)) {
+		err(ERR_DOMAIN);
+		return NULL;
+	}
+	return order_quantile(r, p, dn_to_int(type), x);
+}
+
+
 /* rng/taus.c from the GNU Scientific Library.
  * The period of this generator is about 2^88.
  */
@@ -726,22 +1695,115 @@ static void taus_seed(unsigned long int s) {
 		taus_get();
 }
 
+/* xoshiro256** by Blackman and Vigna.  The period is 2^256 - 1 and
+ * XJUMP advances the state by 2^128 steps which splits the sequence into
+ * non-overlapping streams, one per jump.  It is selected by XSEED and
+ * the Tausworthe generator by SEED.  The state is not kept over a
+ * power cycle.
+ */
+static unsigned long long int XoState[4];
+static int RandXoshiro;
+static decNumber RvSpare;		// second normal of a polar pair
+static int RvHaveSpare;
+
+static unsigned long long int xo_rotl(const unsigned long long int x, int k) {
+	return (x << k) | (x >> (64 - k));
+}
+
+static unsigned long long int xo_get(void) {
+	unsigned long long int *const s = XoState;
+	const unsigned long long int r = xo_rotl(s[1] * 5, 7) * 9;
+	const unsigned long long int t = s[1] << 17;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = xo_rotl(s[3], 45);
+	return r;
+}
+
+// The state is expanded from the seed using splitmix64
+static void xo_seed(unsigned long long int s) {
+	unsigned long long int z;
+	int i;
+
+	for (i=0; i<4; i++) {
+		z = (s += 0x9e3779b97f4a7c15ULL);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		XoState[i] = z ^ (z >> 31);
+	}
+}
+
+static void xo_jump(void) {
+	static const unsigned long long int jump[4] = {
+		0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+		0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+	};
+	unsigned long long int s[4] = { 0, 0, 0, 0 };
+	int i, b, j;
+
+	for (i=0; i<4; i++)
+		for (b=0; b<64; b++) {
+			if (jump[i] & (1ULL << b))
+				for (j=0; j<4; j++)
+					s[j] ^= XoState[j];
+			xo_get();
+		}
+	for (j=0; j<4; j++)
+		XoState[j] = s[j];
+}
+
+/* A uniform deviate on [0, 1) from the selected generator.  The
+ * Tausworthe generator gives the same values as it always has.  The
+ * xoshiro one uses the high word of the product of its output and 10^16
+ * which is a sixteen digit decimal with negligible bias.
+ */
+#define XO_DIGITS	16
+#define XO_SCALE	10000000000000000ULL		/* 10^XO_DIGITS */
+#define XO_MASK		0xffffffffULL
+
+static decNumber *rand_uniform(decNumber *r) {
+	unsigned long long int x, xl, xh, a, b, c, d;
+	const unsigned long long int sl = XO_SCALE & XO_MASK, sh = XO_SCALE >> 32;
+	decNumber z;
+
+	if (! RandXoshiro) {
+		ullint_to_dn(&z, taus_get());
+		return dn_multiply(r, &z, &const_randfac);
+	}
+	x = xo_get();
+	xl = x & XO_MASK;
+	xh = x >> 32;
+	a = xl * sl;
+	b = xh * sl;
+	c = xl * sh;
+	d = xh * sh;
+	a = (a >> 32) + (b & XO_MASK) + (c & XO_MASK);
+	ullint_to_dn(&z, d + (b >> 32) + (c >> 32) + (a >> 32));
+	return dn_mulpow10(r, &z, -XO_DIGITS);
+}
+
+static void rand_check_seed(void) {
+	if (! RandXoshiro && RandS1 == 0 && RandS2 == 0 && RandS3 == 0)
+		taus_seed(0);
+}
+
 void stats_random(enum nilop op) {
 	// Start by generating the next in sequence
 	unsigned long int s;
-	decNumber y, z;
-
-	if (RandS1 == 0 && RandS2 == 0 && RandS3 == 0)
-		taus_seed(0);
-	s = taus_get();
+	decNumber y;
 
-	// Now build ourselves a number
-	if (is_intmode())
-		setX_int_sgn((((unsigned long long int)taus_get()) << 32) | s, 0);
+	rand_check_seed();
+	if (! is_intmode())
+		setX(rand_uniform(&y));
+	else if (RandXoshiro)
+		setX_int_sgn(xo_get(), 0);
 	else {
-		ullint_to_dn(&z, s);
-		dn_multiply(&y, &z, &const_randfac);
-		setX(&y);
+		s = taus_get();
+		setX_int_sgn((((unsigned long long int)taus_get()) << 32) | s, 0);
 	}
 }
 
@@ -758,6 +1820,507 @@ void stats_sto_random(enum nilop op) {
 		s = (unsigned long int) dn_to_ull(&x, &z);
 	}
 	taus_seed(s);
+	RandXoshiro = 0;
+	RvHaveSpare = 0;
+}
+
+/* Standard normal deviates by Marsaglia's polar method.  They come in
+ * pairs, the second is kept for the next call.
+ */
+static decNumber *rv_normal(decNumber *r) {
+	decNumber u, v, s, t, w;
+
+	if (RvHaveSpare) {
+		RvHaveSpare = 0;
+		return decNumberCopy(r, &RvSpare);
+	}
+	do {
+		dn_mul2(&t, rand_uniform(&w));
+		dn_m1(&u, &t);
+		dn_mul2(&t, rand_uniform(&w));
+		dn_m1(&v, &t);
+		decNumberSquare(&t, &u);
+		decNumberSquare(&w, &v);
+		dn_add(&s, &t, &w);
+	} while (dn_ge(&s, &const_1) || dn_eq0(&s));
+	// sqrt(-2 ln(s) / s)
+	dn_ln(&t, &s);
+	dn_multiply(&w, &t, &const__2);
+	dn_divide(&t, &w, &s);
+	dn_sqrt(&w, &t);
+	dn_multiply(&RvSpare, &v, &w);
+	RvHaveSpare = 1;
+	return dn_multiply(r, &u, &w);
+}
+
+/* Fill the register block given by sss.nn in X with uniform deviates
+ * on [0, 1).  R-Nrml below fills it with normal ones.
+ */
+void stats_random_fill(enum nilop op) {
+	decNumber u;
+	int b, n, i;
+
+	if (reg_decode(&b, &n, NULL, 0))
+		return;
+	busy();
+	rand_check_seed();
+	for (i=0; i<n; i++)
+		setRegister(b + i, rand_uniform(&u));
+}
+
+// Seed xoshiro256** from X and select it
+void stats_xseed(enum nilop op) {
+	unsigned long long int s;
+	int z;
+	decNumber x;
+
+	if (is_intmode())
+		s = getX_int();
+	else {
+		getX(&x);
+		s = dn_to_ull(&x, &z);
+	}
+	xo_seed(s);
+	RandXoshiro = 1;
+	RvHaveSpare = 0;
+}
+
+/* Advance xoshiro256** by X times 2^128 steps.  Each jump runs the
+ * generator 256 times so the count is limited.  The generator must have
+ * been selected by XSEED, an unseeded state never leaves zero.
+ */
+#define XJUMP_MAX	1000
+
+void stats_xjump(enum nilop op) {
+	decNumber x, t;
+	int n;
+
+	if (! RandXoshiro) {
+		err(ERR_BAD_MODE);
+		return;
+	}
+	getX(&x);
+	if (! is_int(&x) || dn_lt0(&x)) {
+		err(ERR_DOMAIN);
+		return;
+	}
+	int_to_dn(&t, XJUMP_MAX);
+	if (dn_gt(&x, &t)) {
+		err(ERR_RANGE);
+		return;
+	}
+	n = dn_to_int(&x);
+	while (n-- > 0)
+		xo_jump();
+	RvHaveSpare = 0;
+}
+
+/* Random variates for the distributions in the catalogue.  The
+ * parameters come from J and K as they do for the distribution
+ * functions:
+ *	normal		mean in J, standard deviation in K
+ *	t, chi^2	degrees of freedom in J
+ *	exponential	rate in J
+ *	Weibull		shape in J, scale in K
+ *	Poisson		mean in J
+ *	binomial	probability in J, number of trials in K
+ * Normals use the polar method, keeping the spare of each pair.  Gamma
+ * variates, and from them chi^2 and t, use Marsaglia and Tsang.
+ * Poisson and binomial use Hormann's transformed rejection (PTRS and
+ * BTRS) for means of ten or more and inversion below that.  Everything
+ * is computed to a couple of digits beyond register precision.
+ */
+enum {
+	RV_NORMAL, RV_T, RV_CHI2, RV_EXPON, RV_WEIBULL, RV_POISSON, RV_BINOMIAL
+};
+
+typedef struct {
+	int dist;
+	decNumber j, k;
+	decNumber gd, gc, gsq, ginv;	// gamma: d, c, squeeze and 1/a
+	decNumber a, b, c, vr, alpha, lpq, h;
+	decNumber c043, c007, c0013;
+	int n, m, gboost, flip, small;
+} Variate;
+
+// m 10^e
+static decNumber *rv_const(decNumber *r, int m, int e) {
+	int_to_dn(r, m);
+	r->exponent += e;
+	return r;
+}
+
+static decNumber *rv_open(decNumber *r) {
+	do
+		rand_uniform(r);
+	while (dn_eq0(r));
+	return r;
+}
+
+// Shape a, unit scale
+static void rv_gamma_setup(Variate *v, const decNumber *a) {
+	decNumber t, u;
+
+	v->gboost = dn_lt(a, &const_1);
+	if (v->gboost) {
+		decNumberRecip(&v->ginv, a);
+		dn_p1(&u, a);
+		a = &u;
+	}
+	dn_divide(&t, &const_1, &const_3);
+	dn_subtract(&v->gd, a, &t);
+	dn_multiply(&t, &v->gd, &const_9);
+	dn_sqrt(&u, &t);
+	decNumberRecip(&v->gc, &u);
+	rv_const(&v->gsq, 331, -4);
+}
+
+static decNumber *rv_gamma(const Variate *v, decNumber *r) {
+	decNumber x, x2, s, t, u, w;
+
+	for (;;) {
+		do {
+			rv_normal(&x);
+			dn_multiply(&t, &x, &v->gc);
+			dn_p1(&w, &t);
+		} while (dn_le0(&w));
+		decNumberSquare(&t, &w);
+		dn_multiply(&s, &t, &w);		// (1 + c x)^3
+		rv_open(&u);
+		decNumberSquare(&x2, &x);
+		decNumberSquare(&t, &x2);
+		dn_multiply(&w, &t, &v->gsq);
+		dn_1m(&t, &w);
+		if (dn_lt(&u, &t))
+			break;
+		// ln u < x^2 / 2 + d (1 - s + ln s)
+		dn_ln(&t, &s);
+		dn_1m(&w, &s);
+		dn_add(&w, &w, &t);
+		dn_multiply(&t, &w, &v->gd);
+		dn_div2(&w, &x2);
+		dn_add(&w, &w, &t);
+		dn_ln(&t, &u);
+		if (dn_lt(&t, &w))
+			break;
+	}
+	dn_multiply(r, &v->gd, &s);
+	if (v->gboost) {
+		dn_power(&t, rv_open(&u), &v->ginv);
+		dn_multiply(r, r, &t);
+	}
+	return r;
+}
+
+static void rv_poisson_setup(Variate *v) {
+	decNumber s, t;
+
+	v->small = dn_lt(&v->j, &const_10);
+	if (v->small) {
+		dn_minus(&t, &v->j);
+		dn_exp(&v->h, &t);
+		return;
+	}
+	dn_sqrt(&s, &v->j);
+	dn_ln(&v->lpq, &v->j);
+	// b = 0.931 + 2.53 sqrt(mu), a = 0.02483 b - 0.059
+	dn_multiply(&t, rv_const(&v->b, 253, -2), &s);
+	dn_add(&v->b, &t, rv_const(&s, 931, -3));
+	dn_multiply(&t, rv_const(&v->a, 2483, -5), &v->b);
+	dn_subtract(&v->a, &t, rv_const(&s, 59, -3));
+	// ln(1 / alpha) = ln(1.1239 + 1.1328 / (b - 3.4))
+	dn_subtract(&s, &v->b, rv_const(&t, 34, -1));
+	dn_divide(&v->alpha, rv_const(&t, 11328, -4), &s);
+	dn_add(&t, &v->alpha, rv_const(&s, 11239, -4));
+	dn_ln(&v->alpha, &t);
+	// vr = 0.9277 - 3.6224 / (b - 2)
+	dn_subtract(&s, &v->b, &const_2);
+	dn_divide(&t, rv_const(&v->vr, 36224, -4), &s);
+	dn_subtract(&v->vr, rv_const(&s, 9277, -4), &t);
+	rv_const(&v->c043, 43, -2);
+	rv_const(&v->c007, 7, -2);
+	rv_const(&v->c0013, 13, -3);
+}
+
+static decNumber *rv_poisson(const Variate *v, decNumber *r) {
+	decNumber u, us, vv, k, s, t, w;
+	int n;
+
+	if (v->small) {
+		// Multiply uniforms until the product drops to exp(-mu)
+		dn_1(&s);
+		for (n=0; ; n++) {
+			dn_multiply(&t, &s, rand_uniform(&u));
+			if (! dn_gt(&t, &v->h))
+				break;
+			decNumberCopy(&s, &t);
+		}
+		int_to_dn(r, n);
+		return r;
+	}
+	for (;;) {
+		dn_subtract(&u, rand_uniform(&w), &const_0_5);
+		rand_uniform(&vv);
+		dn_abs(&t, &u);
+		dn_subtract(&us, &const_0_5, &t);
+		if (dn_eq0(&us))
+			continue;
+		// k = floor((2 a / us + b) u + mu + 0.43)
+		dn_mul2(&t, &v->a);
+		dn_divide(&w, &t, &us);
+		dn_add(&t, &w, &v->b);
+		dn_multiply(&w, &t, &u);
+		dn_add(&t, &w, &v->j);
+		dn_add(&w, &t, &v->c043);
+		decNumberFloor(&k, &w);
+		if (dn_ge(&us, &v->c007) && ! dn_gt(&vv, &v->vr))
+			break;
+		if (dn_lt0(&k) || (dn_lt(&us, &v->c0013) && dn_gt(&vv, &us)))
+			continue;
+		// ln v + ln(1 / alpha) - ln(a / us^2 + b) <= k ln mu - mu - ln k!
+		decNumberSquare(&t, &us);
+		dn_divide(&w, &v->a, &t);
+		dn_add(&t, &w, &v->b);
+		dn_ln(&w, &t);
+		dn_ln(&t, &vv);
+		dn_add(&t, &t, &v->alpha);
+		dn_subtract(&s, &t, &w);
+		dn_multiply(&t, &k, &v->lpq);
+		dn_subtract(&w, &t, &v->j);
+		dn_p1(&t, &k);
+		decNumberLnGamma(&u, &t);
+		dn_subtract(&t, &w, &u);
+		if (! dn_gt(&s, &t))
+			break;
+	}
+	return decNumberCopy(r, &k);
+}
+
+// ln x! + ln (n - x)!
+static decNumber *rv_lnfacts(decNumber *r, int x, int n) {
+	decNumber s, t;
+
+	int_to_dn(&t, x + 1);
+	decNumberLnGamma(&s, &t);
+	int_to_dn(&t, n - x + 1);
+	decNumberLnGamma(r, &t);
+	return dn_add(r, r, &s);
+}
+
+static void rv_binomial_setup(Variate *v) {
+	decNumber p, q, s, t, u;
+
+	v->n = dn_to_int(&v->k);
+	v->flip = dn_gt(&v->j, &const_0_5);
+	if (v->flip)
+		dn_1m(&p, &v->j);
+	else
+		decNumberCopy(&p, &v->j);
+	dn_1m(&q, &p);
+	dn_multiply(&v->c, &v->k, &p);
+	v->small = dn_lt(&v->c, &const_10);
+	if (v->small) {
+		// Inversion: r0 = q^n, r(x) = r(x-1) ((n + 1) p/q / x - p/q)
+		dn_divide(&v->b, &p, &q);
+		dn_p1(&t, &v->k);
+		dn_multiply(&v->a, &t, &v->b);
+		dn_power(&v->h, &q, &v->k);
+		return;
+	}
+	dn_multiply(&t, &v->c, &q);
+	dn_sqrt(&s, &t);				// sqrt(n p q)
+	// b = 1.15 + 2.53 spq, a = -0.0873 + 0.0248 b + 0.01 p
+	dn_multiply(&t, rv_const(&u, 253, -2), &s);
+	dn_add(&v->b, &t, rv_const(&u, 115, -2));
+	dn_multiply(&t, rv_const(&u, 248, -4), &v->b);
+	dn_subtract(&v->a, &t, rv_const(&u, 873, -4));
+	dn_multiply(&t, rv_const(&u, 1, -2), &p);
+	dn_add(&v->a, &v->a, &t);
+	dn_add(&v->c, &v->c, &const_0_5);		// n p + 1/2
+	// vr = 0.92 - 4.2 / b, alpha = (2.83 + 5.1 / b) spq
+	dn_divide(&t, rv_const(&u, 42, -1), &v->b);
+	dn_subtract(&v->vr, rv_const(&u, 92, -2), &t);
+	dn_divide(&t, rv_const(&u, 51, -1), &v->b);
+	dn_add(&t, &t, rv_const(&u, 283, -2));
+	dn_multiply(&v->alpha, &t, &s);
+	dn_divide(&t, &p, &q);
+	dn_ln(&v->lpq, &t);
+	dn_p1(&t, &v->k);
+	dn_multiply(&u, &t, &p);
+	decNumberFloor(&t, &u);
+	v->m = dn_to_int(&t);
+	rv_lnfacts(&v->h, v->m, v->n);
+	rv_const(&v->c007, 7, -2);
+}
+
+static decNumber *rv_binomial(const Variate *v, decNumber *r) {
+	decNumber u, us, vv, k, s, t, w;
+	int x;
+
+	if (v->small) {
+		do {
+			rand_uniform(&u);
+			decNumberCopy(&s, &v->h);
+			for (x=0; x<=v->n && ! dn_lt(&u, &s); x++) {
+				dn_subtract(&u, &u, &s);
+				int_to_dn(&t, x + 1);
+				dn_divide(&w, &v->a, &t);
+				dn_subtract(&t, &w, &v->b);
+				dn_multiply(&s, &s, &t);
+			}
+		} while (x > v->n);
+	} else {
+		for (;;) {
+			dn_subtract(&u, rand_uniform(&w), &const_0_5);
+			rand_uniform(&vv);
+			dn_abs(&t, &u);
+			dn_subtract(&us, &const_0_5, &t);
+			if (dn_eq0(&us))
+				continue;
+			// k = floor((2 a / us + b) u + c)
+			dn_mul2(&t, &v->a);
+			dn_divide(&w, &t, &us);
+			dn_add(&t, &w, &v->b);
+			dn_multiply(&w, &t, &u);
+			dn_add(&t, &w, &v->c);
+			decNumberFloor(&k, &t);
+			x = dn_to_int(&k);
+			if (dn_lt0(&k) || x > v->n)
+				continue;
+			if (dn_ge(&us, &v->c007) && ! dn_gt(&vv, &v->vr))
+				break;
+			// ln(v alpha / (a / us^2 + b)) <= h - ln k! - ln (n - k)! + (k - m) ln(p / q)
+			decNumberSquare(&t, &us);
+			dn_divide(&w, &v->a, &t);
+			dn_add(&t, &w, &v->b);
+			dn_multiply(&w, &vv, &v->alpha);
+			dn_divide(&s, &w, &t);
+			dn_ln(&w, &s);
+			rv_lnfacts(&t, x, v->n);
+			dn_subtract(&s, &v->h, &t);
+			int_to_dn(&t, x - v->m);
+			dn_multiply(&u, &t, &v->lpq);
+			dn_add(&t, &s, &u);
+			if (! dn_gt(&w, &t))
+				break;
+		}
+	}
+	int_to_dn(r, v->flip ? v->n - x : x);
+	return r;
+}
+
+/* Check the parameters and precompute what we can.
+ */
+static int rv_setup(Variate *v, int dist) {
+	decNumber t;
+	int bad = 0;
+
+	v->dist = dist;
+	getRegister(&v->j, regJ_idx);
+	getRegister(&v->k, regK_idx);
+	switch (dist) {
+	case RV_NORMAL:
+		bad = dn_le0(&v->k);
+		break;
+	case RV_T:
+	case RV_CHI2:
+		bad = dn_le0(&v->j);
+		if (! bad) {
+			dn_div2(&t, &v->j);
+			rv_gamma_setup(v, &t);
+		}
+		break;
+	case RV_EXPON:
+		bad = dn_le0(&v->j);
+		break;
+	case RV_WEIBULL:
+		bad = dn_le0(&v->j) || dn_le0(&v->k);
+		if (! bad)
+			decNumberRecip(&v->ginv, &v->j);
+		break;
+	case RV_POISSON:
+		bad = dn_le0(&v->j);
+		if (! bad)
+			rv_poisson_setup(v);
+		break;
+	case RV_BINOMIAL:
+		bad = dn_lt0(&v->j) || dn_gt(&v->j, &const_1) || dn_lt0(&v->k) || ! is_int(&v->k);
+		if (! bad)
+			rv_binomial_setup(v);
+		break;
+	}
+	if (bad || decNumberIsNaN(&v->j) || decNumberIsNaN(&v->k)) {
+		err(ERR_DOMAIN);
+		return 1;
+	}
+	return 0;
+}
+
+static decNumber *rv_draw(const Variate *v, decNumber *r) {
+	decNumber s, t;
+
+	switch (v->dist) {
+	default:
+	case RV_NORMAL:
+		dn_multiply(&t, rv_normal(&s), &v->k);
+		return dn_add(r, &t, &v->j);
+	case RV_CHI2:
+		return dn_mul2(r, rv_gamma(v, &t));
+	case RV_T:
+		// Z / sqrt(chi^2 / n)
+		dn_mul2(&s, rv_gamma(v, &t));
+		dn_divide(&t, &s, &v->j);
+		dn_sqrt(&s, &t);
+		return dn_divide(r, rv_normal(&t), &s);
+	case RV_EXPON:
+		dn_ln(&t, rv_open(&s));
+		dn_divide(&s, &t, &v->j);
+		return dn_minus(r, &s);
+	case RV_WEIBULL:
+		dn_ln(&t, rv_open(&s));
+		dn_minus(&s, &t);
+		dn_power(&t, &s, &v->ginv);
+		return dn_multiply(r, &t, &v->k);
+	case RV_POISSON:
+		return rv_poisson(v, r);
+	case RV_BINOMIAL:
+		return rv_binomial(v, r);
+	}
+}
+
+static int rv_digits(void) {
+	const int digits = Ctx.digits;
+
+	Ctx.digits = (is_dblmode() ? DECIMAL128_Pmax : DECIMAL64_Pmax) + 2;
+	return digits;
+}
+
+// A single variate into X
+void stats_variate(enum nilop op) {
+	const int digits = rv_digits();
+	Variate v;
+	decNumber r;
+
+	rand_check_seed();
+	if (! rv_setup(&v, op - OP_RV_NORMAL))
+		setX(rv_draw(&v, &r));
+	Ctx.digits = digits;
+}
+
+// Fill the register block given by sss.nn in X
+void stats_variate_fill(enum nilop op) {
+	const int digits = rv_digits();
+	Variate v;
+	decNumber r;
+	int b, n, i;
+
+	rand_check_seed();
+	if (! reg_decode(&b, &n, NULL, 0) && ! rv_setup(&v, op - OP_RV_FILL_NORMAL)) {
+		busy();
+		for (i=0; i<n; i++)
+			setRegister(b + i, rv_draw(&v, &r));
+	}
+	Ctx.digits = digits;
 }
 
 static void check_low(decNumber *d) {
@@ -765,21 +2328,27 @@ static void check_low(decNumber *d) {
 		decNumberCopy(d, &const_1e_32);
 }
 
-static void ib_step(decNumber *d, decNumber *c, const decNumber *aa) {
+/* One step of the modified Lentz algorithm for the term num/den.
+ * d = 1 / (1 + aa d) and c = 1 + aa / c with aa = num / den are
+ * rearranged so that each costs a single divide.
+ */
+static void ib_step(decNumber *d, decNumber *c, const decNumber *num, const decNumber *den) {
 	decNumber t, u;
 
-	dn_multiply(&t, aa, d);
-	dn_p1(&u, &t);		// d = 1+aa*d
+	dn_multiply(&t, num, d);
+	dn_add(&u, den, &t);
 	check_low(&u);
-	decNumberRecip(d, &u);
-	dn_divide(&t, aa, c);
-	dn_p1(c, &t);		// c = 1+aa/c
+	dn_divide(d, den, &u);		// d = den/(den+num*d)
+	dn_multiply(&t, den, c);
+	dn_divide(&u, num, &t);
+	dn_p1(c, &u);			// c = 1+num/(den*c)
 	check_low(c);
 }
 
 
 static void betacf(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *x) {
-	decNumber aa, c, d, apb, am1, ap1, m, m2, oldr;
+	const decNumber *tol = is_dblmode() ? &const_1e_37 : &const_1e_32;
+	decNumber c, d, apb, am1, ap1, m, m2;
 	int i;
 	decNumber t, u, v, w;
 
@@ -787,15 +2356,13 @@ static void betacf(decNumber *r, const decNumber *a, const decNumber *b, const d
 	dn_m1(&am1, a);				// am1 = a-1
 	dn_add(&apb, a, b);			// apb = a+b
 	dn_1(&c);				// c = 1
-	dn_divide(&t, x, &ap1);
-	dn_multiply(&u, &t, &apb);
-	dn_1m(&t, &u);				// t = 1-apb*x/ap1
-	check_low(&t);
-	decNumberRecip(&d, &t);			// d = 1/t
+	dn_multiply(&t, x, &apb);
+	dn_subtract(&u, &ap1, &t);		// u = ap1-apb*x
+	check_low(&u);
+	dn_divide(&d, &ap1, &u);		// d = 1/(1-apb*x/ap1)
 	decNumberCopy(r, &d);				// res = d
 	decNumberZero(&m);
 	for (i=0; i<500; i++) {
-		decNumberCopy(&oldr, r);
 		dn_inc(&m);			// m = i+1
 		dn_mul2(&m2, &m);
 		dn_subtract(&t, b, &m);
@@ -804,8 +2371,7 @@ static void betacf(decNumber *r, const decNumber *a, const decNumber *b, const d
 		dn_add(&u, &am1, &m2);
 		dn_add(&v, a, &m2);
 		dn_multiply(&w, &u, &v);	// w = (am1+m2)*(a+m2)
-		dn_divide(&aa, &t, &w);	// aa = t/w
-		ib_step(&d, &c, &aa);
+		ib_step(&d, &c, &t, &w);
 		dn_multiply(&t, r, &d);
 		dn_multiply(r, &t, &c);	// r = r*d*c
 		dn_add(&t, a, &m);
@@ -816,21 +2382,71 @@ static void betacf(decNumber *r, const decNumber *a, const decNumber *b, const d
 		dn_add(&t, a, &m2);
 		dn_add(&u, &ap1, &m2);
 		dn_multiply(&v, &t, &u);	// v = (a+m2)*(ap1+m2)
-		dn_divide(&aa, &w, &v);	// aa = w/v
-		ib_step(&d, &c, &aa);
+		ib_step(&d, &c, &w, &v);
 		dn_multiply(&v, &d, &c);
 		dn_multiply(r, r, &v);	// r *= d*c
-		if (dn_eq(&oldr, r))
+		dn_m1(&t, &v);
+		if (dn_abs_lt(&t, tol))
 			break;
 		busy();
 	}
 }
 
+/* Ix(a, b) for a positive integer b is the finite sum
+ *	x^a sum_{j<b} (a)_j / j! (1-x)^j
+ * of positive terms, which needs neither ln B(a, b) nor the continued
+ * fraction.  This covers the binomial distribution.
+ */
+static decNumber *ib_finite(decNumber *r, const decNumber *a, int b, const decNumber *x, const decNumber *y) {
+	decNumber s, t, u, v, j;
+	int i;
+
+	dn_1(&s);
+	dn_1(&t);
+	decNumberCopy(&u, a);
+	decNumberZero(&j);
+	for (i=1; i<b; i++) {
+		dn_inc(&j);
+		dn_multiply(&v, &t, &u);
+		dn_multiply(&t, &v, y);
+		dn_divide(&t, &t, &j);		// t *= (a+i-1) y / i
+		dn_add(&s, &s, &t);
+		dn_inc(&u);
+	}
+	dn_power(&t, x, a);
+	return dn_multiply(r, &t, &s);
+}
+
+// Number of terms if n is an integer in [1, 100], zero otherwise
+static int ib_finite_count(const decNumber *n) {
+	if (! is_int(n) || dn_le0(n) || dn_gt(n, &const_100))
+		return 0;
+	return dn_to_int(n);
+}
+
+/* ln B(a, b) costs three log gammas.  A quantile search calls us over
+ * and over with the same shape, so keep the last one around.
+ */
+static struct {
+	decNumber a, b, lnbeta;
+	int digits;
+} BetaCache;
+
+static decNumber *ib_lnbeta(decNumber *r, const decNumber *a, const decNumber *b) {
+	if (BetaCache.digits != Ctx.digits || ! dn_eq(&BetaCache.a, a) || ! dn_eq(&BetaCache.b, b)) {
+		decNumberLnBeta(&BetaCache.lnbeta, a, b);
+		decNumberCopy(&BetaCache.a, a);
+		decNumberCopy(&BetaCache.b, b);
+		BetaCache.digits = Ctx.digits;
+	}
+	return decNumberCopy(r, &BetaCache.lnbeta);
+}
+
 /* Regularised incomplete beta function Ix(a, b)
  */
 decNumber *betai(decNumber *r, const decNumber *b, const decNumber *a, const decNumber *x) {
 	decNumber t, u, v, w, y;
-	int limit = 0;
+	int limit = 0, lower, n;
 
 	dn_compare(&t, &const_1, x);
 	if (decNumberIsNegative(x) || decNumberIsNegative(&t)) {
@@ -838,34 +2454,41 @@ decNumber *betai(decNumber *r, const decNumber *b, const decNumber *a, const dec
 	}
 	if (dn_eq0(x) || dn_eq0(&t))
 		limit = 1;
-	else {
-		decNumberLnBeta(&u, a, b);
-		dn_ln(&v, x);			// v = ln(x)
-		dn_multiply(&t, a, &v);
-		dn_subtract(&v, &t, &u);	// v = lng(...)+a.ln(x)
-		dn_1m(&y, x);			// y = 1-x
-		dn_ln(&u, &y);			// u = ln(1-x)
-		dn_multiply(&t, &u, b);
-		dn_add(&u, &t, &v);		// u = lng(...)+a.ln(x)+b.ln(1-x)
-		dn_exp(&w, &u);
-	}
+	dn_1m(&y, x);				// y = 1-x
 	dn_add(&v, a, b);
 	dn_p2(&u, &v);				// u = a+b+2
 	dn_p1(&t, a);				// t = a+1
 	dn_divide(&v, &t, &u);			// u = (a+1)/(a+b+2)
-	if (dn_lt(x, &v)) {
-		if (limit)
-			return decNumberZero(r);
+	lower = dn_lt(x, &v);
+	if (limit)
+		return lower ? decNumberZero(r) : dn_1(r);
+
+	/* Integer shapes have a finite expansion.  Away from the lower
+	 * tail only use the one in a, since it gives 1 - Ix(a, b).
+	 */
+	if ((n = ib_finite_count(b)) != 0)
+		return ib_finite(r, a, n, x, &y);
+	if (! lower && (n = ib_finite_count(a)) != 0) {
+		ib_finite(&t, b, n, &y, x);
+		return dn_1m(r, &t);
+	}
+
+	ib_lnbeta(&u, a, b);
+	dn_ln(&v, x);			// v = ln(x)
+	dn_multiply(&t, a, &v);
+	dn_subtract(&v, &t, &u);	// v = lng(...)+a.ln(x)
+	dn_ln(&u, &y);			// u = ln(1-x)
+	dn_multiply(&t, &u, b);
+	dn_add(&u, &t, &v);		// u = lng(...)+a.ln(x)+b.ln(1-x)
+	dn_exp(&w, &u);
+	if (lower) {
 		betacf(&t, a, b, x);
 		dn_divide(&u, &t, a);
 		return dn_multiply(r, &w, &u);
-	} else {
-		if (limit)
-			return dn_1(r);
-		betacf(&t, b, a, &y);
-		dn_divide(&u, &t, b);
-		dn_multiply(&t, &w, &u);
-		return dn_1m(r, &t);
 	}
+	betacf(&t, b, a, &y);
+	dn_divide(&u, &t, b);
+	dn_multiply(&t, &w, &u);
+	return dn_1m(r, &t);
 }
 
@@ -21,11 +21,9 @@
  *  Define register block
  */
 typedef struct _stat_data {
-	// The next four are higher precision
+	// Higher precision, the other sums of squares and products
+	// are recovered from the central moments
 	decimal128 sX2Y;
-	decimal128 sX2;		
-	decimal128 sY2;		
-	decimal128 sXY;
 
 	decimal64 sX;		
 	decimal64 sY;		
@@ -37,18 +35,50 @@ typedef struct _stat_data {
 	decimal64 sXlnY;	
 	decimal64 sYlnX;
 
+	// Central moments, x then y
+	decimal64 sMean[2];
+	decimal64 sM2[2];
+	decimal64 sM3[2];
+	decimal64 sM4[2];
+	decimal64 sC;		// co-moment
+
 	signed int sN;		
 } STAT_DATA;
 
+/*
+ *  Register block before the central moments were added
+ */
+typedef struct _stat_data_v0 {
+	decimal128 sX2Y;
+	decimal128 sX2;
+	decimal128 sY2;
+	decimal128 sXY;
+	decimal64 sX;
+	decimal64 sY;
+	decimal64 slnX[7];	// the logarithmic sums as above
+	signed int sN;
+} STAT_DATA_V0;
+
+#define SIZE_STAT_DATA_V0 sizeof(STAT_DATA_V0)
+
 extern STAT_DATA *StatRegs;
 
 extern int  sigmaCheck(void);
 extern void sigmaDeallocate(void);
 extern int  sigmaCopy(void *source);
+extern int  sigmaCopyV0(void *source);
+extern void sigmaUpgrade(void);
 extern void sigma_clear(enum nilop);
 extern int sigma_plus_x(const decNumber*);
 extern void sigma_plus(void);
 extern void sigma_minus(void);
+extern void sigma_regs(enum nilop);
+#ifdef INCLUDE_SIGMA_CSV
+extern void sigma_csv(enum nilop);
+#endif
+#ifdef LAZY_SIGMA
+extern void sigma_flush(void);
+#endif
 
 extern void stats_mean(enum nilop);
 extern void stats_wmean(enum nilop);
@@ -60,6 +90,12 @@ extern decNumber *stats_yhat(decNumber *, const decNumber *);
 extern void stats_correlation(enum nilop);
 extern void stats_COV(enum nilop);
 extern void stats_LR(enum nilop);
+extern void stats_shape(enum nilop);
+extern decNumber *stats_regmin(decNumber *, const decNumber *);
+extern decNumber *stats_regmax(decNumber *, const decNumber *);
+extern decNumber *stats_regmedian(decNumber *, const decNumber *);
+extern decNumber *stats_regkth(decNumber *, const decNumber *, const decNumber *);
+extern decNumber *stats_regquantile(decNumber *, const decNumber *, const decNumber *, const decNumber *);
 extern void stats_SErr(enum nilop);
 extern decNumber *stats_sigper(decNumber *, const decNumber *);
 
@@ -71,6 +107,11 @@ extern void stats_mode(enum nilop op);
 
 extern void stats_random(enum nilop);
 extern void stats_sto_random(enum nilop);
+extern void stats_random_fill(enum nilop);
+extern void stats_xseed(enum nilop);
+extern void stats_xjump(enum nilop);
+extern void stats_variate(enum nilop);
+extern void stats_variate_fill(enum nilop);
 
 extern decNumber *betai(decNumber *, const decNumber *, const decNumber *, const decNumber *);
 extern decNumber *pdf_Q(decNumber *q, const decNumber *x);
@@ -45,6 +45,7 @@
 #include "display.h"
 #include "stats.h"
 #include "alpha.h"
+#include "matrix.h"
 
 #define PAGE_SIZE	 256
 
@@ -237,6 +238,9 @@ void clrall(void)
 	clralpha( OP_CLRALPHA );
 	clrflags( OP_CLFLAGS );
 	clpall();
+#ifdef MATRIX_HEAP
+	matrix_heap_clear();
+#endif
 
 	reset_shift();
 	State2.test = TST_NONE;
@@ -605,6 +609,9 @@ void flash_backup( enum nilop op )
 	if ( not_running() ) {
 		process_cmdline_set_lift();
 		init_state();
+#ifdef LAZY_SIGMA
+		sigma_flush();
+#endif
 		checksum_all();
 
 		if ( program_flash( &BackupFlash, &PersistentRam, sizeof( BackupFlash ) / PAGE_SIZE ) ) {
@@ -697,6 +704,13 @@ void load_sigma( enum nilop op )
 		err( ERR_MORE_POINTS );
 		return;
 	}
+	if ( ! BackupFlash._state.sigma_moments ) {
+		/*
+		 *  Backup uses the register layout without the central moments
+		 */
+		sigmaCopyV0( ( (char *)( BackupFlash._regs + TOPREALREG - BackupFlash._numregs ) - SIZE_STAT_DATA_V0 ) );
+		return;
+	}
 	sigmaCopy( ( (char *)( BackupFlash._regs + TOPREALREG - BackupFlash._numregs ) - sizeof( STAT_DATA ) ) );
 }
 
@@ -796,6 +810,50 @@ void recall_program( enum nilop op )
 
 
 #if !defined(REALBUILD) && !defined(QTGUI) && !defined(IOS)
+#ifdef MATRIX_HEAP
+/*
+ *  The heap matrices follow the RAM image in the state file.
+ *  Each slot is stored as the row and column count of its largest
+ *  allocation followed by the elements; an empty slot has zero rows.
+ */
+static void save_matrix_heap( FILE *f )
+{
+	int i, rows, cols;
+	unsigned char dims[ 2 ];
+	const decimal64 *m;
+
+	for ( i = 0; i < MATRIX_HEAP_SLOTS; ++i ) {
+		m = matrix_heap_slot( i, &rows, &cols );
+		dims[ 0 ] = m == NULL ? 0 : rows;
+		dims[ 1 ] = m == NULL ? 0 : cols;
+		fwrite( dims, sizeof( dims ), 1, f );
+		if ( m != NULL )
+			fwrite( m, sizeof( decimal64 ), rows * cols, f );
+	}
+}
+
+static void load_matrix_heap( FILE *f )
+{
+	int i;
+	unsigned char dims[ 2 ];
+	decimal64 *m;
+
+	matrix_heap_clear();
+	for ( i = 0; i < MATRIX_HEAP_SLOTS; ++i ) {
+		if ( fread( dims, sizeof( dims ), 1, f ) != 1 )
+			break;				// older state file
+		if ( dims[ 0 ] == 0 )
+			continue;
+		m = matrix_heap_alloc( i, dims[ 0 ], dims[ 1 ] );
+		if ( m == NULL
+		  || fread( m, sizeof( decimal64 ), dims[ 0 ] * dims[ 1 ], f ) != (size_t) ( dims[ 0 ] * dims[ 1 ] ) ) {
+			matrix_heap_clear();
+			break;
+		}
+	}
+}
+#endif
+
 /*
  *  Save/Load state to a file (only for emulator(s))
  */
@@ -805,8 +863,14 @@ void save_statefile( void )
 	if ( f == NULL ) return;
 	process_cmdline_set_lift();
 	init_state();
+#ifdef LAZY_SIGMA
+	sigma_flush();
+#endif
 	checksum_all();
 	fwrite( &PersistentRam, sizeof( PersistentRam ), 1, f );
+#ifdef MATRIX_HEAP
+	save_matrix_heap( f );
+#endif
 	fclose( f );
 #ifdef DEBUG
 	printf( "sizeof struct _state = %d\n", (int)sizeof( struct _state ) );
@@ -828,6 +892,9 @@ void load_statefile( void )
 	FILE *f = fopen( STATE_FILE, "rb" );
 	if ( f != NULL ) {
 		fread( &PersistentRam, sizeof( PersistentRam ), 1, f );
+#ifdef MATRIX_HEAP
+		load_matrix_heap( f );
+#endif
 		fclose( f );
 	}
 	f = fopen( BACKUP_FILE, "rb" );
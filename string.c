@@ -42,6 +42,18 @@ void *xset(void *d, const char c, int n) {
         return d;
 }
 
+/* Compare two blocks of memory, return zero if they are the same.
+ */
+int xcmp(const void *a, const void *b, int n) {
+        const unsigned char *ap = a;
+        const unsigned char *bp = b;
+
+        while (n--)
+                if (*ap++ != *bp++)
+                        return ap[-1] - bp[-1];
+        return 0;
+}
+
 
 #if defined(REALBUILD) && !defined(HOSTBUILD)
 /* Needed by the C runtime */
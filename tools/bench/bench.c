@@ -0,0 +1,660 @@
+/* Host timings for the figures quoted in the commit messages:
+ *
+ *	make bench
+ *	./bench [-g] [-n scale] [case ...]
+ *
+ * With no case named all of them run.  -g uses the classic grey screen for
+ * the drawing cases and -n divides the repeat counts, -n 10 gives a quick
+ * check that everything still runs.  The times are host microseconds, only
+ * the ratios carry over to the calculator.  As with the headless build they
+ * go to stderr since the shift state is printed on stdout.
+ */
+#include <os.h>
+#include "headless.h"
+
+#include "xeq.h"
+#include "decn.h"
+#include "consts.h"
+#include "storage.h"
+#include "keys.h"
+#include "display.h"
+#include "lcd.h"
+#include "graph.h"
+#include "asset.h"
+#include "image.h"
+#include "sprite.h"
+#include "matrix.h"
+#include "stats.h"
+#include "poly.h"
+
+/* graph.c primitives without a prototype in graph.h */
+extern void LCD_XLine(char *VRAM, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int c);
+extern void LCD_YLine(char *VRAM, unsigned int x0, unsigned int y0, unsigned int y1, unsigned int c);
+extern void LCD_String(char *VRAM, unsigned int left, unsigned int top, unsigned char *s, unsigned int color);
+extern void LCD_Display_12X20_Chr(unsigned char *VRAM, unsigned int left, unsigned int top, unsigned char chr);
+
+static int Scale = 1;
+static int Cx = 1;
+
+static double now(void) {
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1e6 + tv.tv_usec;
+}
+
+static int reps(int n) {
+	n /= Scale;
+	return n < 1 ? 1 : n;
+}
+
+static void report(const char *what, double t, int n) {
+	fprintf(stderr, "  %-40s %10.2f us\n", what, t / n);
+	if (Error != ERR_NONE) {
+		fprintf(stderr, "  %-40s error %d\n", "", Error);
+		Error = ERR_NONE;
+	}
+}
+
+//Bytes copied to the screen pages since the count was at before, per run
+static void screen(const char *per, unsigned long before, int n) {
+	fprintf(stderr, "  %-40s %10.0f B%s to screen\n", "", (double) (headless_screen_bytes - before) / n, per);
+}
+
+/* Time count runs of the statement, i_ counts them.  TIME_EACH reports
+ * the time per item when each run handles several.
+ */
+#define TIME_EACH(what, count, items, ...)			\
+	do {							\
+		int n_ = reps(count), i_;			\
+		double t_ = now();				\
+		for (i_ = 0; i_ < n_; i_++) {			\
+			__VA_ARGS__;				\
+		}						\
+		report(what, now() - t_, n_ * (items));		\
+	} while (0)
+#define TIME(what, count, ...)	TIME_EACH(what, count, 1, __VA_ARGS__)
+
+static decNumber *num(decNumber *r, const char *s) {
+	decNumberFromString(r, s, &Ctx);
+	return r;
+}
+
+static decNumber *integer(decNumber *r, int n) {
+	int_to_dn(r, n);
+	return r;
+}
+
+/* Matrix descriptor base.rrcc */
+static decNumber *descriptor(decNumber *r, int base, int rows, int cols) {
+	int_to_dn(r, (base * 100 + rows) * 100 + cols);
+	r->exponent -= 4;
+	return r;
+}
+
+/* Register block descriptor s.nn */
+static decNumber *block(decNumber *r, int s, int n) {
+	int_to_dn(r, s * 100 + n);
+	r->exponent -= 2;
+	return r;
+}
+
+/* Reproducible pseudo random integers in [-10000, 10000] */
+static unsigned int Seed;
+
+static int lcg(void) {
+	Seed = Seed * 1103515245 + 12345;
+	return (int) ((Seed >> 8) % 20001) - 10000;
+}
+
+static void set_reg(int r, int v, int exp) {
+	decNumber x;
+
+	int_to_dn(&x, v);
+	x.exponent += exp;
+	setRegister(r, &x);
+}
+
+static void pack(decimal64 *p, int v, int exp) {
+	decNumber x;
+
+	int_to_dn(&x, v);
+	x.exponent += exp;
+	packed_from_number(p, &x);
+}
+
+/* A diagonally dominant heap matrix in slot, scaled by k */
+static decimal64 *heap_matrix(int slot, int n, int k) {
+	decimal64 *a = matrix_heap_alloc(slot, n, n);
+	int i, j;
+
+	if (a != NULL)
+		for (i=0; i<n; i++)
+			for (j=0; j<n; j++)
+				pack(a + i * n + j, k * (i == j ? 200 + 10 * i : (i * 7 + j * 3) % 11 - 5), -1);
+	return a;
+}
+
+static decimal64 *heap_vector(int slot, int n) {
+	decimal64 *b = matrix_heap_alloc(slot, n, 1);
+	int i;
+
+	if (b != NULL)
+		for (i=0; i<n; i++)
+			pack(b + i, i + 1, 0);
+	return b;
+}
+
+
+/* user-026, user-027, user-028: M×, LINEQS and M.INV */
+static void bench_matrix(void) {
+	decNumber a, b, c, r, x;
+	char what[64];
+	int i, n;
+
+	for (i=0; i<36; i++)
+		set_reg(i, i % 7 == 0 ? 200 + i : (i * 7) % 11 - 5, -1);
+	TIME("M* 6x6 registers", 20000, matrix_multiply(&r, descriptor(&a, 0, 6, 6), &a, integer(&c, 40)));
+
+	for (n=10; n<=50; n+=20) {
+		heap_matrix(0, n, 1);
+		heap_vector(1, n);
+		descriptor(&a, 3000, n, n);
+		descriptor(&b, 3001, n, 1);
+		integer(&c, 3002);
+		sprintf(what, "M* %dx%d heap", n, n);
+		TIME(what, 200000 / (n * n * n) + 1, matrix_multiply(&r, &a, &a, integer(&x, 3003)));
+		sprintf(what, "LINEQS %dx%d, decomposed each time", n, n);
+		heap_matrix(4, n, 2);
+		TIME(what, 100000 / (n * n * n) + 1,
+			matrix_linear_eqn(&r, descriptor(&a, i_ & 1 ? 3004 : 3000, n, n), &b, &c));
+		sprintf(what, "LINEQS %dx%d, cached", n, n);
+		descriptor(&a, 3000, n, n);
+		matrix_linear_eqn(&r, &a, &b, &c);
+		TIME(what, 2000000 / (n * n) + 1, matrix_linear_eqn(&r, &a, &b, &c));
+		sprintf(what, "M.INV %dx%d heap", n, n);
+		TIME(what, 100000 / (n * n * n) + 1, (heap_matrix(0, n, 1), setX(&a), matrix_inverse(OP_MAT_INVERSE)));
+	}
+	matrix_heap_clear();
+}
+
+/* user-030: Cholesky, least squares and refined solves of ill conditioned systems */
+static void bench_solvers(void) {
+	static const char *names[] = { "Hilbert", "Lehmer" };
+	static const int sizes[] = { 10, 40 };
+	decNumber a, a2, b, c, r, x, y, v;
+	decimal64 *p, *q;
+	char what[64];
+	int kind, s, n, i, j;
+
+	for (kind=0; kind<2; kind++)
+		for (s=0; s<2; s++) {
+			n = sizes[s];
+			if (kind == 0 && n > 10)
+				continue;
+			p = matrix_heap_alloc(0, n, n);
+			q = matrix_heap_alloc(1, n, n);
+			heap_vector(2, n);
+			if (p == NULL || q == NULL)
+				return;
+			for (i=0; i<n; i++)
+				for (j=0; j<n; j++) {
+					if (kind == 0)
+						dn_divide(&v, &const_1, integer(&x, i + j + 1));
+					else
+						dn_divide(&v, integer(&x, (i < j ? i : j) + 1), integer(&y, (i < j ? j : i) + 1));
+					packed_from_number(p + i * n + j, &v);
+					dn_add(&v, &v, &v);
+					packed_from_number(q + i * n + j, &v);
+				}
+			descriptor(&a, 3000, n, n);
+			descriptor(&a2, 3001, n, n);
+			descriptor(&b, 3002, n, 1);
+			integer(&c, 3003);
+			/* Alternate A and 2A so the LU cache never hits */
+			sprintf(what, "%s %d LINEQS", names[kind], n);
+			TIME(what, 20000 / (n * n) + 1, matrix_linear_eqn(&r, i_ & 1 ? &a2 : &a, &b, &c));
+			sprintf(what, "%s %d LINSPD", names[kind], n);
+			TIME(what, 20000 / (n * n) + 1, matrix_spd_eqn(&r, i_ & 1 ? &a2 : &a, &b, &c));
+			sprintf(what, "%s %d LINREF", names[kind], n);
+			TIME(what, 20000 / (n * n) + 1, matrix_refine_eqn(&r, i_ & 1 ? &a2 : &a, &b, &c));
+			sprintf(what, "%s %d LINLSQ", names[kind], n);
+			TIME(what, 20000 / (n * n) + 1, matrix_lsq_eqn(&r, i_ & 1 ? &a2 : &a, &b, &c));
+		}
+	matrix_heap_clear();
+}
+
+/* user-031, user-032, user-033: Σ+ one at a time, in bulk and from a file */
+static void bench_sigma(void) {
+	char path[] = "/tmp/benchXXXXXX";
+	decNumber x, y;
+	FILE *f;
+	int fd, i, k;
+
+	for (i=0; i<50; i++) {
+		set_reg(i, (i + 1) * 100 + i % 97, -2);
+		set_reg(50 + i, (3 * i + 7) * 100 + i % 13, -2);
+	}
+	sigma_clear(OP_SIGMACLEAR);
+	TIME("S+ of a register pair", 10000,
+		(getRegister(&x, i_ % 50), getRegister(&y, 50 + i_ % 50), setXY(&x, &y), sigma_plus()));
+	UState.sigma_mode = SIGMA_POWER;
+	TIME("first power L.R. after S+", 2000, (sigma_plus(), stats_LR(OP_statLR)));
+	TIME("power L.R. again", 20000, stats_LR(OP_statLR));
+	UState.sigma_mode = SIGMA_LINEAR;
+
+	sigma_clear(OP_SIGMACLEAR);
+	TIME("R-S+ of 50 pairs", 2000, (setX(block(&x, 0, 50)), sigma_regs(OP_SIGMA_REGS)));
+
+	fd = mkstemp(path);
+	if (fd < 0 || (f = fdopen(fd, "w")) == NULL) {
+		perror(path);
+		return;
+	}
+	fprintf(f, "x,y\n");
+	for (k=0; k<200; k++)
+		for (i=0; i<50; i++)
+			fprintf(f, "%d.%d7, \"%d.3%d\"\r\n", i + 1, i % 97, 3 * i + 7, i % 13);
+	fclose(f);
+	sigma_clear(OP_SIGMACLEAR);
+	strcpy(Alpha, path);
+	TIME("SCSV of 10^4 lines", 20, (sigma_clear(OP_SIGMACLEAR), sigma_csv(OP_SIGMA_CSV)));
+	unlink(path);
+	sigma_clear(OP_SIGMACLEAR);
+}
+
+/* user-034: SORT over the usual orderings */
+static int order(int kind, int i, int n) {
+	switch (kind) {
+	case 0:		return i;
+	case 1:		return n - i;
+	case 2:		return (int) ((i * 2654435761u) >> 8) % 100000;
+	case 3:		return i < n / 2 ? i : n - i;
+	default:	return 7;
+	}
+}
+
+static void fill_regs(int kind, int n) {
+	int i;
+
+	for (i=0; i<n; i++)
+		set_reg(i, order(kind, i, n), 0);
+}
+
+static void bench_sort(void) {
+	static const char *names[] = { "sorted", "reversed", "random", "organ pipe", "equal" };
+	decNumber x;
+	char what[64];
+	int k;
+
+	for (k=0; k<5; k++) {
+		sprintf(what, "SORT 100 %s", names[k]);
+		TIME(what, 2000, (fill_regs(k, 100), setX(block(&x, 0, 100)), op_regsort(OP_REGSORT)));
+	}
+	TIME("refill only", 2000, (fill_regs(2, 100), setX(block(&x, 0, 100))));
+}
+
+/* user-035: order statistics over a register block */
+static void bench_order(void) {
+	decNumber r, x, t, p;
+
+	fill_regs(2, 100);
+	block(&x, 0, 100);
+	TIME("R-MED of 100", 5000, stats_regmedian(&r, &x));
+	integer(&t, 7);
+	num(&p, "0.9");
+	TIME("R-QNT type 7 at 0.9 of 100", 5000, stats_regquantile(&r, &t, &p, &x));
+}
+
+/* user-036: filling registers with uniforms and jumping the xoshiro stream */
+static void bench_random(void) {
+	decNumber x;
+
+	setX(integer(&x, 7));
+	stats_sto_random(OP_STORANDOM);
+	TIME_EACH("RAN# STO per register", 500, 100,
+		{
+			int k;
+			for (k=0; k<100; k++) {
+				stats_random(OP_RANDOM);
+				getX(&x);
+				setRegister(k, &x);
+			}
+		});
+	TIME_EACH("R-RAN per register, Tausworthe", 500, 100, (setX(block(&x, 0, 100)), stats_random_fill(OP_RANDOM_FILL)));
+	setX(integer(&x, 7));
+	stats_xseed(OP_XSEED);
+	TIME_EACH("R-RAN per register, xoshiro", 500, 100, (setX(block(&x, 0, 100)), stats_random_fill(OP_RANDOM_FILL)));
+	TIME("XJUMP by 1", 20000, (setX(integer(&x, 1)), stats_xjump(OP_XJUMP)));
+}
+
+/* user-037: direct samplers against RAN# through the quantile function */
+static void variates(const char *what, int fill_op, int qf_op, const char *j, const char *k, int n) {
+	decNumber x;
+	char buf[64];
+
+	setRegister(regJ_idx, num(&x, j));
+	setRegister(regK_idx, num(&x, k));
+	sprintf(buf, "%s by the sampler", what);
+	TIME_EACH(buf, 500, 100, (setX(block(&x, 0, 100)), stats_variate_fill(fill_op)));
+	sprintf(buf, "%s by RAN# and the QF", what);
+	TIME(buf, n, (stats_random(OP_RANDOM), xeq(OP_MON | qf_op)));
+}
+
+static void bench_variates(void) {
+	decNumber x;
+
+	setX(integer(&x, 7));
+	stats_xseed(OP_XSEED);
+	variates("Normal(0, 1)", OP_RV_FILL_NORMAL, OP_qf_Q, "0", "1", 200);
+	variates("Poisson(25)", OP_RV_FILL_POISSON, OP_qf_Plam, "25", "0", 50);
+	variates("Binomial(0.3, 200)", OP_RV_FILL_BINOMIAL, OP_qf_B, "0.3", "200", 20);
+}
+
+/* user-038: the incomplete beta and gamma based distributions */
+static void bench_ibeta(void) {
+	static const struct {
+		const char *what;
+		int op;
+		const char *j, *k, *x;
+	} t[] = {
+		{ "chi^2 cdf, 10 df at 12.5",	OP_cdf_chi2,	"10",	"0",	"12.5" },
+		{ "t cdf, 7 df at 1.3",		OP_cdf_T,	"7",	"0",	"1.3" },
+		{ "F cdf, (5, 12) df at 2.1",	OP_cdf_F,	"5",	"12",	"2.1" },
+		{ "binomial cdf (0.3, 200) at 55", OP_cdf_B,	"0.3",	"200",	"55" },
+		{ "Poisson cdf (25) at 22",	OP_cdf_Plam,	"25",	"0",	"22" },
+		{ "chi^2 QF, 10 df at 0.9",	OP_qf_chi2,	"10",	"0",	"0.9" },
+		{ "t QF, 7 df at 0.9",		OP_qf_T,	"7",	"0",	"0.9" },
+		{ "F QF, (5, 12) df at 0.9",	OP_qf_F,	"5",	"12",	"0.9" },
+	};
+	decNumber x;
+	unsigned int i;
+
+	for (i=0; i<sizeof(t)/sizeof(t[0]); i++) {
+		setRegister(regJ_idx, num(&x, t[i].j));
+		setRegister(regK_idx, num(&x, t[i].k));
+		TIME(t[i].what, 200, (setX(num(&x, t[i].x)), xeq(OP_MON | t[i].op)));
+	}
+}
+
+/* user-039: MLR against LINLSQ and the keystroke route through the normal equations */
+static void bench_mlr(void) {
+	static const int shapes[][2] = { { 20, 3 }, { 50, 5 }, { 99, 8 } };
+	decNumber a, y, c, r, t, xt, xtx, xty;
+	decimal64 *pa, *py;
+	char what[64];
+	unsigned int s;
+	int n, p, i, j;
+
+	for (s=0; s<sizeof(shapes)/sizeof(shapes[0]); s++) {
+		n = shapes[s][0];
+		p = shapes[s][1];
+		pa = matrix_heap_alloc(0, n, p);
+		py = matrix_heap_alloc(1, n, 1);
+		if (pa == NULL || py == NULL)
+			return;
+		Seed = 12345;
+		for (i=0; i<n; i++) {
+			int yy = 0;
+			for (j=0; j<p; j++) {
+				int v = j == 0 ? 10000 : lcg();
+				pack(pa + i * p + j, v, -4);
+				yy += (j % 2 ? -1 : 1) * (j + 1) * v / 2;
+			}
+			pack(py + i, yy + lcg() / 10, -4);
+		}
+		descriptor(&a, 3000, n, p);
+		descriptor(&y, 3001, n, 1);
+
+		sprintf(what, "MLR %dx%d", n, p);
+		TIME(what, 20000 / n + 1, (integer(&c, 3002), setXYZ(&c, &y, &a), matrix_mlr(OP_MAT_MLR)));
+		sprintf(what, "LINLSQ %dx%d", n, p);
+		TIME(what, 20000 / n + 1, matrix_lsq_eqn(&r, &a, &y, integer(&c, 3003)));
+		sprintf(what, "TRANSP, M*, M*, LINEQS %dx%d", n, p);
+		TIME(what, 20000 / n + 1, {
+			matrix_copy(&r, &a, integer(&t, 3004));
+			matrix_transpose(&xt, descriptor(&t, 3004, n, p));
+			matrix_multiply(&xtx, &xt, &a, integer(&c, 3005));
+			matrix_multiply(&xty, &xt, &y, integer(&c, 3006));
+			matrix_linear_eqn(&r, &xtx, &xty, integer(&c, 3007));
+		});
+	}
+	matrix_heap_clear();
+}
+
+/* user-040: PROOTS by degree, POLY and dPOLY against a RCL× RCL+ loop */
+static void bench_poly(void) {
+	decNumber y, r, b;
+	char what[64];
+	int d, i;
+
+	Seed = 7;
+	for (d=5; d<=30; d+=5) {
+		for (i=0; i<=d; i++)
+			set_reg(i, lcg(), -3);
+		block(&b, 0, d + 1);
+		integer(&y, 40);
+		sprintf(what, "PROOTS degree %d", d);
+		TIME(what, 20000 / (d * d) + 1, (setX(&b), poly_roots(&r, &y, &b)));
+
+		num(&y, "0.7");
+		sprintf(what, "POLY degree %d", d);
+		TIME(what, 20000, (setX(&b), poly_eval(&r, &y, &b)));
+		sprintf(what, "dPOLY degree %d", d);
+		TIME(what, 20000, (setXY(&b, &y), poly_deriv(OP_POLY_DERIV)));
+		setRegister(95, &y);
+		sprintf(what, "RCL, RCLx, RCL+ loop degree %d", d);
+		TIME(what, 20000, {
+			int k;
+			xeq(RARG(RARG_RCL, 0));
+			for (k=1; k<=d; k++) {
+				xeq(RARG(RARG_RCL_MU, 95));
+				xeq(RARG(RARG_RCL_PL, k));
+			}
+		});
+	}
+}
+
+/* user-042, user-046: drawing primitives */
+static void bench_raster(void) {
+	char *v = init_VRAM();
+	const void *bar = asset_get(ASSET_BAR);
+
+	if (v == NULL)
+		return;
+	TIME("LCD_FillAll", 2000, LCD_FillAll(v, 0x1234));
+	TIME("LCD_FillRect 100x50", 5000, LCD_FillRect(v, 10, 10, 109, 59, 0x03FA));
+	TIME("LCD_XLine 300", 50000, LCD_XLine(v, 10, 50, 309, 0xF800));
+	TIME("LCD_YLine 200", 50000, LCD_YLine(v, 10, 20, 219, 0xF800));
+	if (bar != NULL)
+		TIME("LCD_DispBmp 320x24 keyed", 2000, LCD_DispBmp(v, 0, 0, 320, 24, (uint16_t *) bar, 0xF81F));
+	TIME("LCD_DispBmp 13x6 segment", 100000, LCD_DispBmp(v, 40, 192, 13, 6, (uint16_t *) gImage_top, 0xF81F));
+	TIME("LCD_String 20 characters", 20000, LCD_String(v, 2, 130, (unsigned char *) "Hello 1.2345E-6 xyz!", 0x0000));
+	TIME("12x20 glyph", 100000, LCD_Display_12X20_Chr((unsigned char *) v, 40, 40, '5'));
+	TIME("AreaClr_VRAM 50x20", 20000, AreaClr_VRAM(v, 100, 100, 149, 119));
+	asset_free(ASSET_BAR);
+	close_VRAM(v);
+}
+
+/* user-043: keyed bitmaps against sprite runs for a digit and the annunciators */
+static void bench_sprite(void) {
+	static const struct {
+		const unsigned char *bmp;
+		const SPRITE *s;
+	} t[] = {
+#define S(n)	{ gImage_##n, &gSprite_##n }
+		S(top), S(lt), S(middle), S(rt), S(lb), S(bottom), S(rb), S(dot), S(comma),
+		S(BEG), S(STO), S(RCL), S(RAD), S(360), S(RPN),
+#undef S
+	};
+	char *v = init_VRAM();
+	int k;
+
+	if (v == NULL)
+		return;
+	LCD_FillAll(v, 0x1234);
+	TIME("digit, 9 keyed bitmaps", 100000,
+		for (k=0; k<9; k++)
+			LCD_DispBmp(v, 19 + 20 * (i_ % 12), 192, t[k].s->w, t[k].s->h, (uint16_t *) t[k].bmp, 0xF81F));
+	TIME("digit, 9 sprites", 100000,
+		for (k=0; k<9; k++)
+			LCD_DispSprite(v, 19 + 20 * (i_ % 12), 192, t[k].s));
+	TIME("annunciators, keyed bitmaps", 100000,
+		for (k=9; k<15; k++)
+			LCD_DispBmp(v, 241, 153, t[k].s->w, t[k].s->h, (uint16_t *) t[k].bmp, 0xF81F));
+	TIME("annunciators, sprites", 100000,
+		for (k=9; k<15; k++)
+			LCD_DispSprite(v, 241, 153, t[k].s));
+	close_VRAM(v);
+}
+
+/* user-044: unpacking the packed images */
+static void bench_asset(void) {
+	static const char *names[] = { "title bar", "digit font", "about page", "help page 0", "help page 1" };
+	char what[64], *buf;
+	int id;
+
+	for (id=0; id<ASSET_COUNT; id++) {
+		buf = malloc(asset_size(id));
+		if (buf == NULL)
+			continue;
+		sprintf(what, "unpack %s, %d bytes", names[id], asset_size(id));
+		TIME(what, 2000, asset_unpack(id, buf));
+		free(buf);
+	}
+	asset_get(ASSET_BAR);
+	TIME("asset_get cached", 1000000, asset_get(ASSET_BAR));
+	asset_free(ASSET_BAR);
+}
+
+/* user-045: the help page slides and a full refresh */
+static void bench_slide(void) {
+	char *a = init_VRAM(), *b = init_VRAM();
+	unsigned long bytes;
+
+	if (a != NULL && b != NULL) {
+		LCD_FillAll(a, 0x1234);
+		LCD_FillAll(b, 0xF800);
+		bytes = headless_screen_bytes;
+		TIME("slide down and up", 2000, (slide_down(a, b, 10), VRAM_A = slide_up(a, b, 10)));
+		screen("", bytes, reps(2000));
+		bytes = headless_screen_bytes;
+		TIME("PutDisp_DDVRAM", 20000, VRAM_A = PutDisp_DDVRAM(VRAM_A));
+		screen("", bytes, reps(20000));
+	}
+	close_VRAM(a);
+	close_VRAM(b);
+}
+
+/* user-041, user-046 to user-050: a key sequence with and without the register panel */
+static void bench_keys(void) {
+	static const int seq[] = {
+		K51, K52, K53, K62, K41, K42, K20, K43, K31, K44, K32, K33, K64, K52, K34, K11,
+		K20, K20, K54, K24, K61, K62, K53, K23, K51, K52, K64, K_F, K44, K53, K24, K24,
+	};
+	const int nk = sizeof(seq) / sizeof(seq[0]);
+	unsigned long touched, bytes;
+	long pixels;
+	double t, t0;
+	int flags, n, i;
+
+	/* The frame comparison is left out of the key time */
+	for (flags=1; flags>=0; flags--) {
+		State2.flags = flags;
+		display();
+		headless_frame();
+		n = reps(20000);
+		pixels = 0;
+		touched = headless_touched;
+		bytes = headless_screen_bytes;
+		t = 0;
+		for (i=0; i<n; i++) {
+			t0 = now();
+			process_keycode(seq[i % nk]);
+			process_keycode(K_RELEASE);
+			t += now() - t0;
+			pixels += headless_frame();
+		}
+		report(flags ? "key with the register panel" : "key without the panel", t, n);
+		fprintf(stderr, "  %-40s %10.0f pixels changed/key\n", "", (double) pixels / n);
+		fprintf(stderr, "  %-40s %10.0f pixels written/key\n", "", (double) (headless_touched - touched) / n);
+		screen("/key", bytes, n);
+	}
+	State2.flags = 1;
+}
+
+static const struct {
+	const char *name;
+	void (*fn)(void);
+} cases[] = {
+	{ "matrix",	&bench_matrix },
+	{ "solvers",	&bench_solvers },
+	{ "sigma",	&bench_sigma },
+	{ "sort",	&bench_sort },
+	{ "order",	&bench_order },
+	{ "random",	&bench_random },
+	{ "variates",	&bench_variates },
+	{ "ibeta",	&bench_ibeta },
+	{ "mlr",	&bench_mlr },
+	{ "poly",	&bench_poly },
+	{ "raster",	&bench_raster },
+	{ "sprite",	&bench_sprite },
+	{ "asset",	&bench_asset },
+	{ "slide",	&bench_slide },
+	{ "keys",	&bench_keys },
+};
+#define NUM_CASES	(sizeof(cases) / sizeof(cases[0]))
+
+static void run(unsigned int i) {
+	fprintf(stderr, "%s (%s)\n", cases[i].name, Cx ? "cx" : "classic");
+	cases[i].fn();
+}
+
+int main(int argc, char *argv[]) {
+	const void *bar;
+	unsigned int i;
+	int opt, a;
+
+	while ((opt = getopt(argc, argv, "gn:")) != -1)
+		switch (opt) {
+		case 'g':	Cx = 0;				break;
+		case 'n':	Scale = atoi(optarg);		break;
+		default:
+			fprintf(stderr, "usage: %s [-g] [-n scale] [case ...]\n", argv[0]);
+			return 2;
+		}
+	if (Scale < 1)
+		Scale = 1;
+	for (a = optind; a < argc; a++) {
+		for (i = 0; i < NUM_CASES; i++)
+			if (strcmp(argv[a], cases[i].name) == 0)
+				break;
+		if (i == NUM_CASES) {
+			fprintf(stderr, "%s: unknown case %s\n", argv[0], argv[a]);
+			return 2;
+		}
+	}
+
+	headless_init(Cx);
+	xeq_init_contexts();
+	init_34s();
+	VRAM_A = init_Screen();
+	LCD_FillAll(VRAM_A, 0x0000);
+	bar = asset_get(ASSET_BAR);
+	if (bar != NULL)
+		LCD_DispBmp(VRAM_A, 0, 0, 320, 24, (uint16_t *) bar, 0xF81F);
+	asset_free(ASSET_BAR);
+	display();
+	JustDisplayed = 0;
+
+	if (optind == argc)
+		for (i = 0; i < NUM_CASES; i++)
+			run(i);
+	else
+		for (a = optind; a < argc; a++)
+			for (i = 0; i < NUM_CASES; i++)
+				if (strcmp(argv[a], cases[i].name) == 0)
+					run(i);
+	close_Screen();
+	return 0;
+}
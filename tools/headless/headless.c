@@ -0,0 +1,121 @@
+/* Headless display backend and the OS and console.c pieces the calculator
+ * needs to run on a host, see headless.h.
+ */
+#include <os.h>
+#include "headless.h"
+
+#include "xeq.h"
+#include "keys.h"
+#include "serial.h"
+
+void *headless_screen;
+int is_cx = 1, is_classic = 0, is_touchpad = 0;
+
+static unsigned char *Last;	// Shown page at the previous headless_frame()
+
+unsigned long headless_touched, headless_screen_bytes, headless_slept;
+
+void headless_init(int cx) {
+	is_cx = cx;
+	is_classic = ! cx;
+	free(headless_screen);
+	free(Last);
+	headless_screen = calloc(1, SCREEN_BYTES_SIZE);
+	Last = calloc(1, SCREEN_BYTES_SIZE);
+	if (headless_screen == NULL || Last == NULL) {
+		fprintf(stderr, "headless: out of memory\n");
+		exit(1);
+	}
+}
+
+/* Classic pixels go two to a byte, the left one in the high nibble */
+static unsigned int pixel(const unsigned char *p, int x, int y) {
+	if (is_cx)
+		return p[2 * (x + y * SCREEN_WIDTH)] | (p[2 * (x + y * SCREEN_WIDTH) + 1] << 8);
+	p += (x >> 1) + y * (SCREEN_WIDTH / 2);
+	return (x & 1) ? *p & 0x0f : *p >> 4;
+}
+
+long headless_frame(void) {
+	const unsigned char *p = SCREEN_BASE_ADDRESS;
+	long n = 0;
+	int x, y;
+
+	for (y = 0; y < SCREEN_HEIGHT; y++)
+		for (x = 0; x < SCREEN_WIDTH; x++)
+			if (pixel(p, x, y) != pixel(Last, x, y))
+				n++;
+	memcpy(Last, p, SCREEN_BYTES_SIZE);
+	return n;
+}
+
+unsigned long headless_hash(void) {
+	const unsigned char *p = SCREEN_BASE_ADDRESS;
+	uint32_t h = 2166136261u;
+	unsigned int c;
+	int x, y;
+
+	for (y = 0; y < SCREEN_HEIGHT; y++)
+		for (x = 0; x < SCREEN_WIDTH; x++) {
+			c = pixel(p, x, y);
+			h = (h ^ (c & 0xff)) * 16777619u;
+			h = (h ^ (c >> 8)) * 16777619u;
+		}
+	return h;
+}
+
+int headless_dump(const char *path) {
+	const unsigned char *p = SCREEN_BASE_ADDRESS;
+	unsigned int c;
+	int x, y;
+	FILE *f = fopen(path, "wb");
+
+	if (f == NULL)
+		return 1;
+	fprintf(f, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+	for (y = 0; y < SCREEN_HEIGHT; y++)
+		for (x = 0; x < SCREEN_WIDTH; x++) {
+			c = pixel(p, x, y);
+			if (is_cx) {
+				putc((c >> 11) * 255 / 31, f);
+				putc(((c >> 5) & 0x3f) * 255 / 63, f);
+				putc((c & 0x1f) * 255 / 31, f);
+			} else {
+				c = (15 - c) * 17;	// 0 is white
+				putc(c, f);
+				putc(c, f);
+				putc(c, f);
+			}
+		}
+	return fclose(f) != 0;
+}
+
+/*
+ *  OS calls
+ */
+void lcd_incolor(void) { }
+void lcd_ingray(void) { }
+BOOL any_key_pressed(void) { return FALSE; }
+void wait_key_pressed(void) { }
+void wait_no_key_pressed(void) { }
+touchpad_info_t *touchpad_getinfo(void) { return NULL; }
+int touchpad_scan(touchpad_report_t *report) { return 0; }
+unsigned int headless_sleep(unsigned int ms) { headless_slept += ms; return 0; }
+
+/*
+ *  What console.c would provide
+ */
+char *VRAM_A;
+
+unsigned long long int instruction_count = 0;
+int view_instruction_counter = 0;
+
+int is_key_pressed(void) { return 0; }
+int get_key(void) { return 0; }
+int put_key(int k) { return k; }
+enum shifts shift_down(void) { return SHIFT_N; }
+
+int open_port(int baud, int bits, int parity, int stopbits) { return 0; }
+void close_port(void) { }
+void put_byte(unsigned char byte) { err(ERR_PROG_BAD); }
+void flush_comm(void) { }
@@ -0,0 +1,28 @@
+/* Headless display backend: the calculator draws through graph.c into
+ * memory as usual and the page shown is whatever SCREEN_BASE_ADDRESS
+ * points at.  Frames can be compared and written out as PPM images.
+ */
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+/* Select the CX (RGB565) or classic (4 bit grey) screen, before init_Screen() */
+extern void headless_init(int cx);
+
+/* Pixels of the shown page that differ from the previous call */
+extern long headless_frame(void);
+
+/* Write the shown page as a binary PPM, non-zero on failure */
+extern int headless_dump(const char *path);
+
+/* FNV-1a hash of the shown page's pixel values, the same on any host */
+extern unsigned long headless_hash(void);
+
+/* Pixels written by graph.c and bytes it copied to the screen pages, both
+ * since start up.  A pixel drawn twice counts twice.
+ */
+extern unsigned long headless_touched, headless_screen_bytes;
+
+/* Milliseconds the calculator asked to sleep for */
+extern unsigned long headless_slept;
+
+#endif
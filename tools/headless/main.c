@@ -0,0 +1,150 @@
+/* Replay keys on the headless display, for golden images and render timing:
+ *
+ *	make headless
+ *	./headless [-g] [-s] [-n reps] [-o prefix] [-h file] key ...
+ *
+ * Keys are named as in keys.h (K51, K_F, ...) and each is pressed and
+ * released in turn.  -g uses the classic grey screen, -s hides the register
+ * panel, -o writes prefix000.ppm for the start and one frame per key on the
+ * first pass and -n repeats the whole sequence for timing.  -h writes the
+ * hash of the same frames one to a line, "make check" compares these with
+ * the golden files here.  The timing goes to stderr since the console build
+ * prints the shift state on stdout.
+ */
+#include <os.h>
+#include "headless.h"
+
+#include "xeq.h"
+#include "keys.h"
+#include "display.h"
+#include "lcd.h"
+#include "graph.h"
+#include "asset.h"
+#include "image.h"
+#include "storage.h"
+
+#define MAX_KEYS	1000
+
+static const struct {
+	const char *name;
+	int code;
+} names[] = {
+#define K(k)	{ #k, k }
+	K(K00), K(K01), K(K02), K(K03), K(K04), K(K05),
+	K(K10), K(K11), K(K12), K(K13), K(K14), K(K15),
+	K(K20), K(K21), K(K22), K(K23), K(K24),
+	K(K30), K(K31), K(K32), K(K33), K(K34),
+	K(K40), K(K41), K(K42), K(K43), K(K44),
+	K(K50), K(K51), K(K52), K(K53), K(K54),
+	K(K60), K(K61), K(K62), K(K63), K(K64),
+	K(K_F), K(K_G), K(K_H), K(K_ARROW), K(K_CMPLX),
+#undef K
+};
+
+static int key(const char *s) {
+	unsigned int i;
+
+	for (i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+		if (strcmp(s, names[i].name) == 0)
+			return names[i].code;
+	return K_UNKNOWN;
+}
+
+static double now(void) {
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1e6 + tv.tv_usec;
+}
+
+static void hash(FILE *f, int n) {
+	fprintf(f, "%03d %08lx\n", n, headless_hash());
+}
+
+static void dump(const char *prefix, int n) {
+	char path[256];
+
+	snprintf(path, sizeof(path), "%s%03d.ppm", prefix, n);
+	if (headless_dump(path)) {
+		perror(path);
+		exit(1);
+	}
+}
+
+int main(int argc, char *argv[]) {
+	static int keys[MAX_KEYS];
+	const char *prefix = NULL;
+	FILE *hashes = NULL;
+	const void *bar;
+	int cx = 1, flags = 1, reps = 1, nk = 0, opt, i, r;
+	long pixels = 0;
+	unsigned long touched, bytes;
+	double t = 0, t0;
+
+	while ((opt = getopt(argc, argv, "gsn:o:h:")) != -1)
+		switch (opt) {
+		case 'g':	cx = 0;			break;
+		case 's':	flags = 0;		break;
+		case 'n':	reps = atoi(optarg);	break;
+		case 'o':	prefix = optarg;	break;
+		case 'h':
+			if ((hashes = fopen(optarg, "w")) == NULL) {
+				perror(optarg);
+				return 1;
+			}
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-g] [-s] [-n reps] [-o prefix] [-h file] key ...\n", argv[0]);
+			return 2;
+		}
+	for (i = optind; i < argc && nk < MAX_KEYS; i++)
+		if ((keys[nk++] = key(argv[i])) == K_UNKNOWN) {
+			fprintf(stderr, "%s: unknown key %s\n", argv[0], argv[i]);
+			return 2;
+		}
+
+	headless_init(cx);
+	xeq_init_contexts();
+	init_34s();
+	State2.flags = flags;
+	VRAM_A = init_Screen();
+	LCD_FillAll(VRAM_A, 0x0000);
+	bar = asset_get(ASSET_BAR);
+	if (bar != NULL)
+		LCD_DispBmp(VRAM_A, 0, 0, 320, 24, (uint16_t *)bar, 0xF81F);
+	asset_free(ASSET_BAR);
+	display();
+	JustDisplayed = 0;
+	headless_frame();
+	if (prefix != NULL)
+		dump(prefix, 0);
+	if (hashes != NULL)
+		hash(hashes, 0);
+	touched = headless_touched;
+	bytes = headless_screen_bytes;
+
+	for (r = 0; r < reps; r++)
+		for (i = 0; i < nk; i++) {
+			t0 = now();
+			process_keycode(keys[i]);
+			process_keycode(K_RELEASE);
+			t += now() - t0;
+			pixels += headless_frame();
+			if (prefix != NULL && r == 0)
+				dump(prefix, i + 1);
+			if (hashes != NULL && r == 0)
+				hash(hashes, i + 1);
+		}
+	if (nk != 0)
+		fprintf(stderr, "%s %d keys x %d: %.2f us/key, %.0f pixels changed/key, "
+			"%.0f pixels written/key, %.0f B/key to screen\n",
+			cx ? "cx" : "classic", nk, reps, t / (nk * reps), (double) pixels / (nk * reps),
+			(double) (headless_touched - touched) / (nk * reps),
+			(double) (headless_screen_bytes - bytes) / (nk * reps));
+	if (hashes != NULL && fclose(hashes) != 0) {
+		perror("hashes");
+		return 1;
+	}
+	close_Screen();
+	return 0;
+}
@@ -0,0 +1,69 @@
+/* Host stand-in for the Ndless os.h, used by the headless build only.
+ *
+ * The LCD base register becomes a plain pointer so the page flipping in
+ * graph.c works unchanged, and is_cx picks the pixel format at run time.
+ * The keypad and touchpad read as idle and sleep() returns at once.
+ */
+#ifndef HEADLESS_OS_H
+#define HEADLESS_OS_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#define SCREEN_WIDTH		320
+#define SCREEN_HEIGHT		240
+#define SCREEN_BYTES_SIZE	(is_cx ? SCREEN_WIDTH * SCREEN_HEIGHT * 2 : SCREEN_WIDTH * SCREEN_HEIGHT / 2)
+#define SCREEN_BASE_ADDRESS	headless_screen
+
+extern void *headless_screen;
+extern int is_cx, is_classic, is_touchpad;
+
+#define BOOL	int
+#define TRUE	1
+#define FALSE	0
+
+typedef struct {
+	int row, col, tpad_row, tpad_col, tpad_arrow;
+} t_key;
+
+typedef struct {
+	unsigned char contact, proximity;
+	unsigned short x, y;
+	unsigned char x_velocity, y_velocity;
+	unsigned short dummy;
+	unsigned char pressed, status;
+} touchpad_report_t;
+
+typedef struct {
+	unsigned short width, height;
+} touchpad_info_t;
+
+#define isKeyPressed(k)		0
+
+/* The Ndless sleep() takes milliseconds, libc's seconds: the slides'
+ * pauses are added up instead of waited out.
+ */
+#define sleep(ms)		headless_sleep(ms)
+extern unsigned int headless_sleep(unsigned int ms);
+
+/* graph.c counts the pixels it writes and the bytes it copies to the
+ * screen pages through these, see headless.h.
+ */
+#define COUNT_TOUCHED(n)	(headless_touched += (n))
+#define COUNT_SCREEN(n)		(headless_screen_bytes += (n))
+extern unsigned long headless_touched, headless_screen_bytes;
+
+extern void lcd_incolor(void);
+extern void lcd_ingray(void);
+extern BOOL any_key_pressed(void);
+extern void wait_key_pressed(void);
+extern void wait_no_key_pressed(void);
+extern touchpad_info_t *touchpad_getinfo(void);
+extern int touchpad_scan(touchpad_report_t *report);
+
+#endif
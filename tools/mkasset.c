@@ -0,0 +1,142 @@
+/* Host side generator for asset.inc, run by the Makefile when the images
+ * change:
+ *
+ *	cc -o mkasset tools/mkasset.c tools/asset_src.c && ./mkasset > asset.inc
+ *
+ * The large images in tools/asset_src.c are packed as LZ4 blocks, greedy
+ * matching with hash chains, and unpacked on the calculator by asset.c.
+ * The table is emitted in the order of the ASSET_ ids in asset.h.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern const unsigned char gImage_bar[], gImage_niexie[];
+extern const unsigned char gImage_about[], gImage_help0[], gImage_help1[];
+extern const unsigned char gImage_about_bw[], gImage_help0_bw[], gImage_help1_bw[];
+
+static const struct {
+	const char *name;
+	const unsigned char *cx, *bw;	/* Classic variant, or NULL if shared */
+	int w, h;
+} assets[] = {
+	{ "bar", gImage_bar, NULL, 320, 24 },
+	{ "niexie", gImage_niexie, NULL, 12, 880 },
+	{ "about", gImage_about, gImage_about_bw, 320, 240 },
+	{ "help0", gImage_help0, gImage_help0_bw, 320, 240 },
+	{ "help1", gImage_help1, gImage_help1_bw, 320, 240 },
+};
+
+#define MINMATCH	4
+#define WINDOW		65535
+#define HASH_BITS	16
+#define CHAIN		256		/* Candidates tried per position */
+#define LASTLITERALS	5		/* LZ4 block format end conditions */
+#define MFLIMIT		12
+
+static unsigned char out[1 << 20];
+
+static unsigned int hash(const unsigned char *p) {
+	unsigned int v = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int) p[3] << 24);
+
+	return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+static unsigned char *length(unsigned char *o, int n) {
+	for (; n >= 255; n -= 255)
+		*o++ = 255;
+	*o++ = n;
+	return o;
+}
+
+static unsigned char *sequence(unsigned char *o, const unsigned char *lit, int nlit, int off, int mlen) {
+	unsigned char *token = o++;
+
+	*token = (nlit < 15 ? nlit : 15) << 4;
+	if (nlit >= 15)
+		o = length(o, nlit - 15);
+	memcpy(o, lit, nlit);
+	o += nlit;
+	if (mlen == 0)
+		return o;
+	*o++ = off & 0xff;
+	*o++ = off >> 8;
+	mlen -= MINMATCH;
+	*token |= mlen < 15 ? mlen : 15;
+	if (mlen >= 15)
+		o = length(o, mlen - 15);
+	return o;
+}
+
+static int pack(const unsigned char *in, int n) {
+	static int head[1 << HASH_BITS];
+	int *prev = malloc(n * sizeof(int));
+	unsigned char *o = out;
+	int i = 0, anchor = 0, j, k, c, best, boff, h;
+
+	memset(head, -1, sizeof(head));
+	while (i + MFLIMIT < n) {
+		h = hash(in + i);
+		best = 0;
+		boff = 0;
+		for (j = head[h], c = 0; j >= 0 && i - j <= WINDOW && c < CHAIN; j = prev[j], c++) {
+			for (k = 0; i + k < n - LASTLITERALS && in[j + k] == in[i + k]; k++)
+				;
+			if (k > best) {
+				best = k;
+				boff = i - j;
+			}
+		}
+		prev[i] = head[h];
+		head[h] = i;
+		if (best < MINMATCH) {
+			i++;
+			continue;
+		}
+		o = sequence(o, in + anchor, i - anchor, boff, best);
+		for (k = 1; k < best && i + k + MFLIMIT < n; k++) {
+			h = hash(in + i + k);
+			prev[i + k] = head[h];
+			head[h] = i + k;
+		}
+		i += best;
+		anchor = i;
+	}
+	o = sequence(o, in + anchor, n - anchor, 0, 0);
+	free(prev);
+	return o - out;
+}
+
+static void emit(const char *name, const char *suffix, const unsigned char *in, int n) {
+	int len = pack(in, n), i;
+
+	printf("\n//%d bytes packed to %d\n", n, len);
+	printf("static const unsigned char asset_%s%s[%d] = {", name, suffix, len);
+	for (i = 0; i < len; i++)
+		printf("%s0X%02X,", i % 16 ? "" : "\n", out[i]);
+	printf("\n};\n");
+}
+
+int main(void) {
+	const int n = sizeof(assets) / sizeof(assets[0]);
+	int i;
+
+	printf("/* Generated from tools/asset_src.c by tools/mkasset.c, do not edit. */\n");
+	for (i = 0; i < n; i++) {
+		emit(assets[i].name, "", assets[i].cx, assets[i].w * assets[i].h * 2);
+		if (assets[i].bw != NULL)
+			emit(assets[i].name, "_bw", assets[i].bw, assets[i].w * assets[i].h / 2);
+	}
+	printf("\nstatic const ASSET_DATA asset_data[ASSET_COUNT] = {\n");
+	for (i = 0; i < n; i++) {
+		printf("\t{ asset_%s, sizeof(asset_%s), %d, ", assets[i].name, assets[i].name,
+			assets[i].w * assets[i].h * 2);
+		if (assets[i].bw != NULL)
+			printf("asset_%s_bw, sizeof(asset_%s_bw), %d },\n", assets[i].name, assets[i].name,
+				assets[i].w * assets[i].h / 2);
+		else
+			printf("NULL, 0, 0 },\n");
+	}
+	printf("};\n");
+	return 0;
+}
@@ -0,0 +1,95 @@
+/* Host side generator for sprite.c, run by the Makefile when image.c changes:
+ *
+ *	cc -o mksprite tools/mksprite.c image.c && ./mksprite > sprite.c
+ *
+ * Each segment bitmap is cut into runs of opaque pixels so drawing it is a
+ * few span copies with no colour key test.  The pixels are stored both as
+ * RGB565 for the CX and already converted to 4 bit grey for the classic.
+ */
+#include <stdio.h>
+
+#define KEY	0xF81F		/* Transparent colour in the bitmaps */
+
+#define S(n, w, h)	{ #n, gImage_##n, w, h }
+#define X(n)		extern const unsigned char gImage_##n[]
+X(top); X(lt); X(middle); X(rt); X(lb); X(bottom); X(rb); X(dot); X(comma);
+X(stop); X(slt); X(smiddle); X(srt); X(slb); X(sbottom); X(srb);
+X(lequal); X(sequal); X(arrow); X(input);
+X(BEG); X(STO); X(RCL); X(RAD); X(360); X(RPN);
+
+static const struct {
+	const char *name;
+	const unsigned char *pic;
+	int w, h;
+} sprites[] = {		/* As drawn, the last row of slb never was */
+	S(top, 13, 6), S(lt, 5, 12), S(middle, 12, 5), S(rt, 5, 13),
+	S(lb, 5, 13), S(bottom, 12, 5), S(rb, 5, 14), S(dot, 5, 4), S(comma, 6, 7),
+	S(stop, 8, 4), S(slt, 4, 8), S(smiddle, 7, 4), S(srt, 4, 7),
+	S(slb, 4, 8), S(sbottom, 7, 4), S(srb, 4, 8),
+	S(lequal, 14, 8), S(sequal, 6, 3), S(arrow, 8, 8), S(input, 28, 8),
+	S(BEG, 19, 8), S(STO, 19, 8), S(RCL, 19, 8), S(RAD, 19, 8),
+	S(360, 19, 8), S(RPN, 19, 8),
+};
+
+/* Same as ColorConverter_CX2CLASSIC() in graph.c */
+static unsigned int classic(unsigned int c) {
+	static const char RedLUT[16] = { 0,0,0,0,0,0,0,0,1,3,5,7,9,11,13,15 };
+
+	return 15 - (RedLUT[((c & 0xF800) >> 11) >> 1] | ((c & 0x001F) >> 1));
+}
+
+static unsigned int pixel(int s, int x, int y) {
+	const unsigned char *p = sprites[s].pic + 2 * (x + y * sprites[s].w);
+
+	return p[0] | (p[1] << 8);
+}
+
+static void list(const char *type, const char *name, const char *part, const unsigned int *v, int n) {
+	int i;
+
+	printf("static const %s gSprite_%s_%s[%d] = {", type, name, part, n);
+	for (i = 0; i < n; i++)
+		printf("%s0X%02X,", i % 16 ? "" : "\n", v[i]);
+	printf("\n};\n");
+}
+
+int main(void) {
+	unsigned int runs[1024], cx[1024], grey[1024];
+	int s, x, y, r, n, p, start;
+
+	printf("/* Generated from image.c by tools/mksprite.c, do not edit. */\n");
+	printf("#include <os.h>\n#include \"sprite.h\"\n");
+	for (s = 0; s < (int) (sizeof(sprites) / sizeof(sprites[0])); s++) {
+		r = p = 0;
+		for (y = 0; y < sprites[s].h; y++) {
+			n = r++;
+			runs[n] = 0;
+			for (x = start = 0; x < sprites[s].w; ) {
+				if (pixel(s, x, y) == KEY) {
+					x++;
+					continue;
+				}
+				runs[r++] = x - start;
+				for (start = x; x < sprites[s].w && pixel(s, x, y) != KEY; x++) {
+					cx[p] = pixel(s, x, y);
+					grey[p] = classic(cx[p]);
+					p++;
+				}
+				runs[r++] = x - start;
+				runs[n]++;
+				start = x;
+			}
+		}
+		printf("\n//%d*%d, %d opaque pixels\n", sprites[s].w, sprites[s].h, p);
+		list("unsigned char", sprites[s].name, "runs", runs, r);
+		printf("static const uint16_t gSprite_%s_cx[%d] = {", sprites[s].name, p);
+		for (x = 0; x < p; x++)
+			printf("%s0X%04X,", x % 8 ? "" : "\n", cx[x]);
+		printf("\n};\n");
+		list("unsigned char", sprites[s].name, "grey", grey, p);
+		printf("const SPRITE gSprite_%s = { %d, %d, gSprite_%s_runs, gSprite_%s_cx, gSprite_%s_grey };\n",
+			sprites[s].name, sprites[s].w, sprites[s].h,
+			sprites[s].name, sprites[s].name, sprites[s].name);
+	}
+	return 0;
+}
@@ -772,11 +772,9 @@ static void getZ(decNumber *z) {
 	getRegister(z, regZ_idx);
 }
 
-#if 0
 static void setZ(const decNumber *z) {
 	setRegister(regZ_idx, z);
 }
-#endif
 
 static void getT(decNumber *t) {
 	getRegister(t, regT_idx);
@@ -797,12 +795,10 @@ void getXYZ(decNumber *x, decNumber *y, decNumber *z) {
 	getZ(z);
 }
 
-#if 0
 void setXYZ(const decNumber *x, const decNumber *y, const decNumber *z) {
 	setXY(x, y);
 	setZ(z);
 }
-#endif
 
 void getXYZT(decNumber *x, decNumber *y, decNumber *z, decNumber *t) {
 	getXYZ(x, y, z);
@@ -3195,8 +3191,8 @@ void op_entryp(enum nilop op) {
 	fin_tst(State.entryp);
 }
 
-/* Bulk register operations */
-int reg_decode(int *s, int *n, int *d, int flash) {
+/* Bulk register operations, the descriptor sss.nnddd is in blk */
+int reg_decode_dn(const decNumber *blk, int *s, int *n, int *d, int flash) {
 	decNumber x, y;
 	int rsrc, num, rdest, q, mx_src, mx_dest;
 
@@ -3204,8 +3200,7 @@ int reg_decode(int *s, int *n, int *d, int flash) {
 		bad_mode_error();
 		return 1;
 	}
-	getX(&x);			// sss.nnddd~
-	dn_mulpow10(&y, &x, 2 + 3);	// sssnnddd.~
+	dn_mulpow10(&y, blk, 2 + 3);	// sssnnddd.~
 	decNumberTrunc(&x, &y);		// sssnnddd.0
 	rsrc = dn_to_int(&x);		// sssnnddd
 
@@ -3276,6 +3271,13 @@ range_error:
 	return 1;
 }
 
+// As above with the descriptor in X
+int reg_decode(int *s, int *n, int *d, int flash) {
+	decNumber x;
+
+	return reg_decode_dn(getX(&x), s, n, d, flash);
+}
+
 void op_regcopy(enum nilop op) {
 	int s, n, d;
 
@@ -3307,55 +3309,180 @@ void op_regclr(enum nilop op) {
 	zero_regs(get_reg_n(s), n);
 }
 
-void op_regsort(enum nilop op) {
-	int s, n;
-	decNumber pivot, a;
-	int beg[10], end[10], i;
+/* Register block sorting.  The block is unpacked once into an array of
+ * keys and an index permutation is sorted with introsort: quicksort on
+ * a median of three pivot that falls back to heapsort if it recurses too
+ * deeply, leaving short runs for a final insertion sort pass.  The
+ * registers are then permuted by copying them so nothing is repacked.
+ * A stable sort breaks ties on the original position.  NaNs sort
+ * after everything else.
+ */
+#define SORT_DESCENDING	1
+#define SORT_STABLE	2
+#define SORT_SMALL	12
+
+typedef struct {
+	decNumber *key;
+	int flags;
+} SortCtx;
+
+static int sort_cmp(const SortCtx *c, int a, int b) {
+	const decNumber *const x = c->key + a;
+	const decNumber *const y = c->key + b;
+	const int nx = decNumberIsNaN(x), ny = decNumberIsNaN(y);
+	decNumber r;
+	int t;
+
+	if (nx || ny)
+		t = nx - ny;
+	else {
+		decNumberCompare(&r, x, y, &Ctx);
+		t = decNumberIsZero(&r) ? 0 : decNumberIsNegative(&r) ? -1 : 1;
+		if (c->flags & SORT_DESCENDING)
+			t = -t;
+	}
+	if (t == 0 && (c->flags & SORT_STABLE))
+		t = a - b;
+	return t;
+}
+
+static void sort_swap(int *p, int i, int j) {
+	const int t = p[i];
+
+	p[i] = p[j];
+	p[j] = t;
+}
+
+static void sort_sift(const SortCtx *c, int *p, int i, int n) {
+	int k;
 
-	if (reg_decode(&s, &n, NULL, 0) || n == 1)
+	while ((k = 2 * i + 1) < n) {
+		if (k + 1 < n && sort_cmp(c, p[k], p[k + 1]) < 0)
+			k++;
+		if (sort_cmp(c, p[i], p[k]) >= 0)
+			break;
+		sort_swap(p, i, k);
+		i = k;
+	}
+}
+
+static void sort_heap(const SortCtx *c, int *p, int n) {
+	int i;
+
+	for (i = n / 2 - 1; i >= 0; i--)
+		sort_sift(c, p, i, n);
+	for (i = n - 1; i > 0; i--) {
+		sort_swap(p, 0, i);
+		sort_sift(c, p, 0, i);
+	}
+}
+
+static void sort_intro(const SortCtx *c, int *p, int n, int depth) {
+	int i, j, pv;
+
+	while (n > SORT_SMALL) {
+		if (depth-- == 0) {
+			sort_heap(c, p, n);
+			return;
+		}
+		/* Order the first, middle and last so they bound the scans */
+		j = n / 2;
+		if (sort_cmp(c, p[j], p[0]) < 0)
+			sort_swap(p, 0, j);
+		if (sort_cmp(c, p[n - 1], p[j]) < 0) {
+			sort_swap(p, j, n - 1);
+			if (sort_cmp(c, p[j], p[0]) < 0)
+				sort_swap(p, 0, j);
+		}
+		pv = p[j];
+		i = 0;
+		j = n - 1;
+		for (;;) {
+			while (sort_cmp(c, p[++i], pv) < 0);
+			while (sort_cmp(c, p[--j], pv) > 0);
+			if (i >= j)
+				break;
+			sort_swap(p, i, j);
+		}
+		/* Recurse into the smaller part and loop on the larger */
+		if (i < n - i) {
+			sort_intro(c, p, i, depth);
+			p += i;
+			n -= i;
+		} else {
+			sort_intro(c, p + i, n - i, depth);
+			n = i;
+		}
+	}
+}
+
+static void sort_insertion(const SortCtx *c, int *p, int n) {
+	int i, j, t;
+
+	for (i = 1; i < n; i++) {
+		t = p[i];
+		for (j = i; j > 0 && sort_cmp(c, t, p[j - 1]) < 0; j--)
+			p[j] = p[j - 1];
+		p[j] = t;
+	}
+}
+
+/* Sort the n registers from s and, if d is not negative, apply the same
+ * permutation to the n registers from d.
+ */
+static void sort_regs(int s, int n, int d, int flags) {
+	REGISTER *regs;
+	SortCtx c;
+	int *perm;
+	int i, depth;
+
+	if (n < 2)
+		return;
+	regs = malloc(n * (2 * sizeof(REGISTER) + sizeof(decNumber) + sizeof(int)));
+	if (regs == NULL) {
+		err(ERR_RAM_FULL);
 		return;
+	}
+	c.key = (decNumber *) (regs + 2 * n);
+	c.flags = flags;
+	perm = (int *) (c.key + n);
 
-	/* Non-recursive quicksort */
-	beg[0] = 0;
-	end[0] = n;
-	i = 0;
-	while (i>=0) {
-		int L = beg[i];
-		int R = end[i] - 1;
-		if (L<R) {
-			const int pvt = s + L;
-			getRegister(&pivot, pvt);
-			while (L<R) {
-				while (L<R) {
-					getRegister(&a, s + R);
-					if (dn_lt(&a, &pivot))
-						break;
-					R--;
-				}
-				if (L<R)
-					copyreg_n(s + L++, s + R);
-				while (L<R) {
-					getRegister(&a, s + L);
-					if (dn_gt(&a, &pivot))
-						break;
-					L++;
-				}
-				if (L<R)
-					copyreg_n(s + R--, s + L);
-			}
-			setRegister(s + L, &pivot);
-			if (L - beg[i] < end[i] - (L+1)) {
-				beg[i+1] = beg[i];
-				end[i+1] = L;
-				beg[i] = L+1;
-			} else {
-				beg[i+1] = L+1;
-				end[i+1] = end[i];
-				end[i] = L;
-			}
-			i++;
-		} else
-			i--;
+	for (i = 0; i < n; i++) {
+		getRegister(c.key + i, s + i);
+		perm[i] = i;
+	}
+	for (depth = 0, i = n; i > 1; i >>= 1)
+		depth += 2;
+	sort_intro(&c, perm, n, depth);
+	sort_insertion(&c, perm, n);
+
+	for (i = 0; i < n; i++) {
+		copyreg(regs + i, get_reg_n(s + i));
+		if (d >= 0)
+			copyreg(regs + n + i, get_reg_n(d + i));
+	}
+	for (i = 0; i < n; i++) {
+		copyreg(get_reg_n(s + i), regs + perm[i]);
+		if (d >= 0)
+			copyreg(get_reg_n(d + i), regs + n + perm[i]);
+	}
+	free(regs);
+}
+
+void op_regsort(enum nilop op) {
+	int s, n, d;
+
+	if (op == OP_REGSORT || op == OP_REGSORTD) {
+		if (reg_decode(&s, &n, NULL, 0))
+			return;
+		sort_regs(s, n, -1, op == OP_REGSORTD ? SORT_DESCENDING : 0);
+	} else {
+		if (reg_decode(&s, &n, &d, 0))
+			return;
+		if ((s >= d && d + n > s) || (d > s && s + n > d))
+			err(ERR_RANGE);
+		else
+			sort_regs(s, n, d, op == OP_REGSORTKD ? SORT_STABLE | SORT_DESCENDING : SORT_STABLE);
 	}
 }
 
@@ -4535,6 +4662,8 @@ void xeq_init_contexts(void) {
 	 */
 	short int s;
 	SizeStatRegs = State.have_stats ? sizeof(STAT_DATA) >> 1 : 0;	// in 16 bit words!
+	if (SizeStatRegs && ! State.sigma_moments)
+		SizeStatRegs = SIZE_STAT_DATA_V0 >> 1;			// older layout, converted below
 	s = ((TOPREALREG - NumRegs) << 2) - SizeStatRegs;		// additional register space
 	RetStk = RetStkBase + s;					// Move RetStk up or down
 	RetStkSize = s + RET_STACK_SIZE - ProgSize;
@@ -4542,6 +4671,16 @@ void xeq_init_contexts(void) {
 	ProgFree = ProgMax - ProgSize + RetStkPtr;
 	StackBase = get_reg_n(regX_idx);
 
+	/*
+	 *  A statistics block saved without the central moments is
+	 *  converted to the current layout, then start over.
+	 */
+	if (State.have_stats && ! State.sigma_moments) {
+		sigmaUpgrade();
+		xeq_init_contexts();
+		return;
+	}
+
 	/*
 	 *  Initialise our standard contexts.
 	 *  We bump the digits for internal calculations.
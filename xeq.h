@@ -666,6 +666,13 @@ enum {
 #ifdef INCLUDE_XROM_DIGAMMA
         OP_DIGAMMA,
 #endif
+#ifdef MATRIX_HEAP
+        OP_MAT_NEW,
+#endif
+#ifdef MATRIX_FACTOR
+        OP_MAT_CHOL,
+#endif
+        OP_REG_MIN, OP_REG_MAX, OP_REG_MEDIAN,
         NUM_MONADIC     // Last entry defines number of operations
 };
     
@@ -715,6 +722,8 @@ enum {
 #ifdef INCLUDE_XROM_BESSEL
         OP_BESJN, OP_BESIN, OP_BESYN, OP_BESKN,
 #endif
+        OP_REG_KTH,
+        OP_POLY, OP_POLY_ROOTS,
 
         NUM_DYADIC      // Last entry defines number of operations
 };
@@ -737,6 +746,11 @@ enum {
 #ifdef INCLUDE_INT_MODULO_OPS
         OP_MULMOD, OP_EXPMOD,
 #endif
+        OP_MAT_GET,
+#ifdef MATRIX_FACTOR
+        OP_MAT_SPD_EQN, OP_MAT_LSQ_EQN, OP_MAT_REF_EQN,
+#endif
+        OP_REG_QUANTILE,
         NUM_TRIADIC     // Last entry defines number of operations
 };  
 
@@ -839,6 +853,23 @@ enum nilop {
 #ifdef INCLUDE_STOPWATCH
         OP_STOPWATCH,
 #endif // INCLUDE_STOPWATCH
+        OP_MAT_PUT,
+#ifdef MATRIX_HEAP
+        OP_MAT_FREE,
+#endif
+        OP_SIGMA_REGS,
+#ifdef INCLUDE_SIGMA_CSV
+        OP_SIGMA_CSV,
+#endif
+        OP_statSKEW, OP_statKURT,
+        OP_REGSORTD, OP_REGSORTK, OP_REGSORTKD,
+        OP_RANDOM_FILL, OP_XSEED, OP_XJUMP,
+        OP_RV_NORMAL, OP_RV_T, OP_RV_CHI2, OP_RV_EXPON, OP_RV_WEIBULL, OP_RV_POISSON, OP_RV_BINOMIAL,
+        OP_RV_FILL_NORMAL, OP_RV_FILL_T, OP_RV_FILL_CHI2, OP_RV_FILL_EXPON, OP_RV_FILL_WEIBULL, OP_RV_FILL_POISSON, OP_RV_FILL_BINOMIAL,
+#ifdef MATRIX_FACTOR
+        OP_MAT_MLR,
+#endif
+        OP_POLY_DERIV,
 #ifdef _DEBUG
         OP_DEBUG,
 #endif
@@ -1094,6 +1125,8 @@ enum shifts {
 
 #define FLASH_REG_BASE 1000             // Dummy index for flash access
 #define CONST_REG_BASE 2000             // Dummy index for constants
+#define MATRIX_HEAP_BASE 3000           // Base of heap matrix descriptors
+#define MATRIX_HEAP_SLOTS 10            // Number of heap matrices
 
 /*
  *  All more or less persistent global data
@@ -1238,6 +1271,7 @@ extern void clr_user_flag(int);
         
 extern void *xcopy(void *, const void *, int);
 extern void *xset(void *, const char, int);
+extern int xcmp(const void *, const void *, int);
 extern char *find_char(const char *, const char);
 #if defined INCLUDE_YREG_CODE && defined INCLUDE_YREG_HMS
 extern void replace_char(char *str, const char from, const char to);
@@ -1359,6 +1393,7 @@ extern void isInfinite(enum nilop op);
 extern void check_zero(enum nilop op);
 extern void op_entryp(enum nilop op);
 extern int reg_decode(int *s, int *n, int *d, int flash);
+extern int reg_decode_dn(const decNumber *blk, int *s, int *n, int *d, int flash);
 extern void op_regcopy(enum nilop op);
 extern void op_regswap(enum nilop op);
 extern void op_regclr(enum nilop op);